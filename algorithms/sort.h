@@ -0,0 +1,45 @@
+#ifndef TJS_SORT_H
+#define TJS_SORT_H
+
+#include <cstddef>
+
+#include "functors/functors.h"
+
+namespace tjs {
+
+// Pattern-defeating quicksort: quicksort with median-of-3/ninther pivots,
+// insertion sort for small ranges, a heapsort fallback that caps the worst
+// case at O(n log n), and linear time on sorted, reversed and
+// all-equal input. When comp is tjs::less/tjs::greater (or the std ones)
+// over an arithmetic type, partitioning is branchless (BlockQuicksort).
+// Not stable.
+template <class RandomIt, class Compare = less<>>
+void sort(RandomIt first, RandomIt last, Compare comp = Compare());
+
+// Stable LSD radix sort, ascending by key(element), which must return an
+// integer or floating point value of 1, 2, 4 or 8 bytes. Passes where every
+// key has the same byte are skipped, so e.g. timestamps sharing their high
+// bytes only pay for the bytes that differ. Negative floats sort before
+// positive ones, -0.0 before 0.0, and NaNs go to the ends by sign.
+// Elements must be default constructible. Uses one scratch buffer of n
+// elements, rounded up to a power of two by tjs::vector, plus 2 KiB per
+// key byte of histograms.
+template <class RandomIt, class KeyFn>
+void radix_sort(RandomIt first, RandomIt last, KeyFn key);
+
+// Radix sorts a range of numbers by value, or a range of tjs::string by
+// their first 8 bytes, finishing runs with a shared prefix by comparison.
+template <class RandomIt>
+void radix_sort(RandomIt first, RandomIt last);
+
+// Sorts chunks of the range on separate threads, then merges them pairwise
+// in parallel rounds. threads = 0 uses std::thread::hardware_concurrency().
+// comp must not throw. Small ranges are sorted on the calling thread.
+template <class RandomIt, class Compare = less<>>
+void parallel_sort(RandomIt first, RandomIt last, Compare comp = Compare(),
+                   size_t threads = 0);
+
+}  // namespace tjs
+
+#include "sort.tpp"
+#endif  // TJS_SORT_H
@@ -0,0 +1,702 @@
+// The pdqsort implementation below (tjs::detail, from the tuning constants
+// through pdqsort_loop) is derived from pdqsort by Orson Peters,
+// https://github.com/orlp/pdqsort. This is an altered version: it was
+// reformatted and renamed into tjs::detail, the branchless partition is
+// selected by a comparator trait, and the rest of this file (radix_sort,
+// parallel_sort) is not part of pdqsort. The original notice follows.
+//
+// pdqsort.h - Pattern-defeating quicksort.
+//
+// Copyright (c) 2021 Orson Peters
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software in
+//    a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "sort.h"
+#include "string/string.h"
+#include "vector/vector.h"
+
+namespace tjs {
+
+namespace detail {
+
+// ------------------------------------------------------------------------
+// Tuning Constants
+// ------------------------------------------------------------------------
+constexpr std::ptrdiff_t INSERTION_SORT_THRESHOLD = 24;
+constexpr std::ptrdiff_t NINTHER_THRESHOLD = 128;
+constexpr size_t PARTIAL_INSERTION_SORT_LIMIT = 8;
+constexpr size_t BLOCK_SIZE = 64;  // Offsets must fit in an unsigned char.
+constexpr size_t CACHELINE_SIZE = 64;
+constexpr size_t RADIX_SORT_THRESHOLD = 64;
+constexpr size_t PARALLEL_SORT_THRESHOLD = 1 << 15;
+
+// Comparators known to be a plain < or > on arithmetic values, where the
+// branchless partition wins.
+template <class Compare, class T>
+struct is_branchless_compare : std::false_type {};
+template <class T>
+struct is_branchless_compare<less<T>, T> : std::is_arithmetic<T> {};
+template <class T>
+struct is_branchless_compare<greater<T>, T> : std::is_arithmetic<T> {};
+template <class T>
+struct is_branchless_compare<less<void>, T> : std::is_arithmetic<T> {};
+template <class T>
+struct is_branchless_compare<greater<void>, T> : std::is_arithmetic<T> {};
+template <class T>
+struct is_branchless_compare<std::less<T>, T> : std::is_arithmetic<T> {};
+template <class T>
+struct is_branchless_compare<std::greater<T>, T> : std::is_arithmetic<T> {};
+
+// ------------------------------------------------------------------------
+// Insertion Sorts
+// ------------------------------------------------------------------------
+
+template <class Iter, class Compare>
+void insertion_sort(Iter begin, Iter end, Compare& comp) {
+  using T = typename std::iterator_traits<Iter>::value_type;
+  if (begin == end) return;
+
+  for (Iter cur = begin + 1; cur != end; ++cur) {
+    Iter sift = cur;
+    Iter sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      T tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (sift != begin && comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+    }
+  }
+}
+
+// Like insertion_sort, but *(begin - 1) must be no greater than anything in
+// the range, which lets the inner loop skip its bounds check.
+template <class Iter, class Compare>
+void unguarded_insertion_sort(Iter begin, Iter end, Compare& comp) {
+  using T = typename std::iterator_traits<Iter>::value_type;
+  if (begin == end) return;
+
+  for (Iter cur = begin + 1; cur != end; ++cur) {
+    Iter sift = cur;
+    Iter sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      T tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+    }
+  }
+}
+
+// Insertion sort that gives up once it has moved more than
+// PARTIAL_INSERTION_SORT_LIMIT elements. Returns whether it finished.
+template <class Iter, class Compare>
+bool partial_insertion_sort(Iter begin, Iter end, Compare& comp) {
+  using T = typename std::iterator_traits<Iter>::value_type;
+  if (begin == end) return true;
+
+  size_t moved = 0;
+  for (Iter cur = begin + 1; cur != end; ++cur) {
+    Iter sift = cur;
+    Iter sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      T tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (sift != begin && comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+      moved += cur - sift;
+    }
+    if (moved > PARTIAL_INSERTION_SORT_LIMIT) return false;
+  }
+  return true;
+}
+
+// ------------------------------------------------------------------------
+// Pivot Selection
+// ------------------------------------------------------------------------
+
+template <class Iter, class Compare>
+void sort2(Iter a, Iter b, Compare& comp) {
+  if (comp(*b, *a)) std::iter_swap(a, b);
+}
+
+template <class Iter, class Compare>
+void sort3(Iter a, Iter b, Iter c, Compare& comp) {
+  sort2(a, b, comp);
+  sort2(b, c, comp);
+  sort2(a, b, comp);
+}
+
+// ------------------------------------------------------------------------
+// Partitioning
+// ------------------------------------------------------------------------
+// All partitions take the pivot from *begin and return where it ended up.
+
+// Elements equal to the pivot go right. Also reports whether the range was
+// already partitioned, i.e. no swaps were needed.
+template <class Iter, class Compare>
+std::pair<Iter, bool> partition_right(Iter begin, Iter end, Compare& comp) {
+  using T = typename std::iterator_traits<Iter>::value_type;
+  T pivot(std::move(*begin));
+  Iter first = begin;
+  Iter last = end;
+
+  // Median-of-3 guarantees an element >= pivot exists on the right.
+  while (comp(*++first, pivot)) {
+  }
+  // Guard the search only if nothing on the left stops it.
+  if (first - 1 == begin) {
+    while (first < last && !comp(*--last, pivot)) {
+    }
+  } else {
+    while (!comp(*--last, pivot)) {
+    }
+  }
+
+  bool already_partitioned = first >= last;
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (comp(*++first, pivot)) {
+    }
+    while (!comp(*--last, pivot)) {
+    }
+  }
+
+  Iter pivot_pos = first - 1;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return std::make_pair(pivot_pos, already_partitioned);
+}
+
+template <class Iter>
+void swap_offsets(Iter first, Iter last, unsigned char* offsets_l,
+                  unsigned char* offsets_r, size_t num, bool use_swaps) {
+  using T = typename std::iterator_traits<Iter>::value_type;
+  if (use_swaps) {
+    // Plain swaps keep descending input O(n).
+    for (size_t i = 0; i < num; ++i) {
+      std::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+    }
+  } else if (num > 0) {
+    // A cyclic permutation does one move per element instead of three.
+    Iter l = first + offsets_l[0];
+    Iter r = last - offsets_r[0];
+    T tmp(std::move(*l));
+    *l = std::move(*r);
+    for (size_t i = 1; i < num; ++i) {
+      l = first + offsets_l[i];
+      *r = std::move(*l);
+      r = last - offsets_r[i];
+      *l = std::move(*r);
+    }
+    *r = std::move(tmp);
+  }
+}
+
+// partition_right without data dependent branches in the hot loop, after
+// "BlockQuicksort: How Branch Mispredictions don't affect Quicksort"
+// (Edelkamp and Weiss). Each side records the offsets of misplaced
+// elements in a small block, then the blocks are swapped in bulk.
+template <class Iter, class Compare>
+std::pair<Iter, bool> partition_right_branchless(Iter begin, Iter end,
+                                                 Compare& comp) {
+  using T = typename std::iterator_traits<Iter>::value_type;
+  T pivot(std::move(*begin));
+  Iter first = begin;
+  Iter last = end;
+
+  while (comp(*++first, pivot)) {
+  }
+  if (first - 1 == begin) {
+    while (first < last && !comp(*--last, pivot)) {
+    }
+  } else {
+    while (!comp(*--last, pivot)) {
+    }
+  }
+
+  bool already_partitioned = first >= last;
+  if (!already_partitioned) {
+    std::iter_swap(first, last);
+    ++first;
+
+    alignas(CACHELINE_SIZE) unsigned char offsets_l[BLOCK_SIZE];
+    alignas(CACHELINE_SIZE) unsigned char offsets_r[BLOCK_SIZE];
+    Iter offsets_l_base = first;
+    Iter offsets_r_base = last;
+    size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+    while (first < last) {
+      // Split the unknown elements between whichever blocks are empty.
+      size_t num_unknown = last - first;
+      size_t left_split =
+          num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+      size_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+      // Record misplaced elements; the store is unconditional, only the
+      // count depends on the comparison.
+      if (left_split >= BLOCK_SIZE) left_split = BLOCK_SIZE;
+      for (size_t i = 0; i < left_split;) {
+        offsets_l[num_l] = static_cast<unsigned char>(i++);
+        num_l += !comp(*first, pivot);
+        ++first;
+      }
+      if (right_split >= BLOCK_SIZE) right_split = BLOCK_SIZE;
+      for (size_t i = 0; i < right_split;) {
+        offsets_r[num_r] = static_cast<unsigned char>(++i);
+        num_r += comp(*--last, pivot);
+      }
+
+      size_t num = std::min(num_l, num_r);
+      swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l,
+                   offsets_r + start_r, num, num_l == num_r);
+      num_l -= num;
+      num_r -= num;
+      start_l += num;
+      start_r += num;
+      if (num_l == 0) {
+        start_l = 0;
+        offsets_l_base = first;
+      }
+      if (num_r == 0) {
+        start_r = 0;
+        offsets_r_base = last;
+      }
+    }
+
+    // One block may still hold misplaced elements, move them to the middle.
+    if (num_l) {
+      while (num_l--) {
+        std::iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+      }
+      first = last;
+    }
+    if (num_r) {
+      while (num_r--) {
+        std::iter_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+        ++first;
+      }
+      last = first;
+    }
+  }
+
+  Iter pivot_pos = first - 1;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return std::make_pair(pivot_pos, already_partitioned);
+}
+
+// Elements equal to the pivot go left. Used when the pivot equals the
+// element just before the range, so the whole equal run is finished at
+// once and many duplicates cost O(n).
+template <class Iter, class Compare>
+Iter partition_left(Iter begin, Iter end, Compare& comp) {
+  using T = typename std::iterator_traits<Iter>::value_type;
+  T pivot(std::move(*begin));
+  Iter first = begin;
+  Iter last = end;
+
+  while (comp(pivot, *--last)) {
+  }
+  if (last + 1 == end) {
+    while (first < last && !comp(pivot, *++first)) {
+    }
+  } else {
+    while (!comp(pivot, *++first)) {
+    }
+  }
+
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (comp(pivot, *--last)) {
+    }
+    while (!comp(pivot, *++first)) {
+    }
+  }
+
+  Iter pivot_pos = last;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return pivot_pos;
+}
+
+// ------------------------------------------------------------------------
+// pdqsort
+// ------------------------------------------------------------------------
+
+template <class T>
+int log2_floor(T n) {
+  int log = 0;
+  while (n >>= 1) ++log;
+  return log;
+}
+
+template <bool Branchless, class Iter, class Compare>
+void pdqsort_loop(Iter begin, Iter end, Compare& comp, int bad_allowed,
+                  bool leftmost) {
+  using diff_t = typename std::iterator_traits<Iter>::difference_type;
+
+  // Recurse into the left part, loop on the right.
+  while (true) {
+    diff_t size = end - begin;
+    if (size < INSERTION_SORT_THRESHOLD) {
+      if (leftmost)
+        insertion_sort(begin, end, comp);
+      else
+        unguarded_insertion_sort(begin, end, comp);
+      return;
+    }
+
+    // Median of 3, or the pseudo median of 9 for big ranges, into *begin.
+    diff_t s2 = size / 2;
+    if (size > NINTHER_THRESHOLD) {
+      sort3(begin, begin + s2, end - 1, comp);
+      sort3(begin + 1, begin + (s2 - 1), end - 2, comp);
+      sort3(begin + 2, begin + (s2 + 1), end - 3, comp);
+      sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp);
+      std::iter_swap(begin, begin + s2);
+    } else {
+      sort3(begin + s2, begin, end - 1, comp);
+    }
+
+    // Nothing in the range is less than *(begin - 1). If the pivot equals
+    // it, every pivot-equal element belongs here; take them all at once.
+    if (!leftmost && !comp(*(begin - 1), *begin)) {
+      begin = partition_left(begin, end, comp) + 1;
+      continue;
+    }
+
+    std::pair<Iter, bool> part = Branchless
+                                     ? partition_right_branchless(begin, end,
+                                                                  comp)
+                                     : partition_right(begin, end, comp);
+    Iter pivot_pos = part.first;
+    bool already_partitioned = part.second;
+
+    diff_t l_size = pivot_pos - begin;
+    diff_t r_size = end - (pivot_pos + 1);
+    bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+    if (highly_unbalanced) {
+      // Too many bad pivots, fall back to heapsort for the O(n log n) bound.
+      if (--bad_allowed == 0) {
+        std::make_heap(begin, end, comp);
+        std::sort_heap(begin, end, comp);
+        return;
+      }
+
+      // Break up patterns by swapping a few elements around.
+      if (l_size >= INSERTION_SORT_THRESHOLD) {
+        std::iter_swap(begin, begin + l_size / 4);
+        std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+        if (l_size > NINTHER_THRESHOLD) {
+          std::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+          std::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+          std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+          std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+        }
+      }
+      if (r_size >= INSERTION_SORT_THRESHOLD) {
+        std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+        std::iter_swap(end - 1, end - r_size / 4);
+        if (r_size > NINTHER_THRESHOLD) {
+          std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+          std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+          std::iter_swap(end - 2, end - (1 + r_size / 4));
+          std::iter_swap(end - 3, end - (2 + r_size / 4));
+        }
+      }
+    } else if (already_partitioned &&
+               partial_insertion_sort(begin, pivot_pos, comp) &&
+               partial_insertion_sort(pivot_pos + 1, end, comp)) {
+      // A well balanced partition that needed no swaps is a hint the input
+      // is nearly sorted; cheap insertion sorts may finish it outright.
+      return;
+    }
+
+    pdqsort_loop<Branchless>(begin, pivot_pos, comp, bad_allowed, leftmost);
+    begin = pivot_pos + 1;
+    leftmost = false;
+  }
+}
+
+// ------------------------------------------------------------------------
+// Radix Sort Helpers
+// ------------------------------------------------------------------------
+
+template <size_t Bytes>
+struct radix_unsigned;
+template <>
+struct radix_unsigned<1> {
+  using type = uint8_t;
+};
+template <>
+struct radix_unsigned<2> {
+  using type = uint16_t;
+};
+template <>
+struct radix_unsigned<4> {
+  using type = uint32_t;
+};
+template <>
+struct radix_unsigned<8> {
+  using type = uint64_t;
+};
+
+// Maps a key to an unsigned integer with the same ordering.
+template <class K>
+typename radix_unsigned<sizeof(K)>::type radix_key(K k) {
+  using U = typename radix_unsigned<sizeof(K)>::type;
+  constexpr U SIGN = U(1) << (sizeof(K) * 8 - 1);
+  if constexpr (std::is_floating_point_v<K>) {
+    // Negative floats sort backwards by their bits, so flip them all;
+    // positive floats just need to land above the negatives.
+    U bits;
+    std::memcpy(&bits, &k, sizeof(K));
+    return (bits & SIGN) ? U(~bits) : U(bits | SIGN);
+  } else if constexpr (std::is_signed_v<K>) {
+    return static_cast<U>(k) ^ SIGN;
+  } else {
+    return static_cast<U>(k);
+  }
+}
+
+// Adapts a key function into a comparator for small ranges.
+template <class KeyFn>
+struct key_less {
+  KeyFn& key;
+
+  template <class T>
+  bool operator()(const T& a, const T& b) const {
+    return radix_key(key(a)) < radix_key(key(b));
+  }
+};
+
+struct identity_key {
+  template <class T>
+  const T& operator()(const T& v) const {
+    return v;
+  }
+};
+
+// First 8 bytes of a string, big endian, zero padded. Orders like the
+// strings themselves except where they share those 8 bytes.
+inline uint64_t string_prefix(const string& s) {
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data());
+  size_t n = std::min<size_t>(s.size(), 8);
+  uint64_t key = 0;
+  for (size_t i = 0; i < n; i++) {
+    key |= uint64_t(p[i]) << (56 - 8 * i);
+  }
+  return key;
+}
+
+template <class RandomIt>
+void string_radix_sort(RandomIt first, RandomIt last) {
+  struct entry {
+    uint64_t prefix;
+    size_t index;
+  };
+  size_t n = last - first;
+  if (n < 2) return;
+
+  // Radix sort (prefix, index) pairs rather than moving strings each pass.
+  vector<entry> entries(n);
+  entry* e = entries.data();
+  for (size_t i = 0; i < n; i++) {
+    e[i].prefix = string_prefix(first[i]);
+    e[i].index = i;
+  }
+  radix_sort(e, e + n, [](const entry& x) { return x.prefix; });
+
+  vector<string> sorted(n);
+  string* s = sorted.data();
+  for (size_t i = 0; i < n; i++) {
+    s[i] = std::move(first[e[i].index]);
+  }
+
+  // Strings sharing all 8 prefix bytes still need a full comparison.
+  less<> comp;
+  for (size_t i = 0; i < n;) {
+    size_t j = i + 1;
+    while (j < n && e[j].prefix == e[i].prefix) j++;
+    if (j - i > 1) {
+      pdqsort_loop<false>(s + i, s + j, comp, log2_floor(j - i), true);
+    }
+    i = j;
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    first[i] = std::move(s[i]);
+  }
+}
+
+}  // namespace detail
+
+// ------------------------------------------------------------------------
+// Public Algorithms
+// ------------------------------------------------------------------------
+
+template <class RandomIt, class Compare>
+void sort(RandomIt first, RandomIt last, Compare comp) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  if (first == last) return;
+  constexpr bool branchless = detail::is_branchless_compare<Compare, T>::value;
+  detail::pdqsort_loop<branchless>(first, last, comp,
+                                   detail::log2_floor(last - first), true);
+}
+
+template <class RandomIt, class KeyFn>
+void radix_sort(RandomIt first, RandomIt last, KeyFn key) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  using K = std::decay_t<decltype(key(*first))>;
+  static_assert(std::is_arithmetic_v<K>,
+                "radix_sort keys must be integers or floating point");
+  static_assert(sizeof(K) == 1 || sizeof(K) == 2 || sizeof(K) == 4 ||
+                    sizeof(K) == 8,
+                "radix_sort keys must be 1, 2, 4 or 8 bytes");
+  using U = typename detail::radix_unsigned<sizeof(K)>::type;
+  constexpr size_t PASSES = sizeof(K);
+
+  size_t n = last - first;
+  if (n < detail::RADIX_SORT_THRESHOLD) {
+    // Insertion sort is stable too, and faster at this size.
+    detail::key_less<KeyFn> comp{key};
+    detail::insertion_sort(first, last, comp);
+    return;
+  }
+
+  // One scan builds the byte histograms for every pass.
+  vector<size_t> counts(PASSES * 256);
+  size_t* c = counts.data();
+  for (size_t i = 0; i < n; i++) {
+    U k = detail::radix_key(key(first[i]));
+    for (size_t p = 0; p < PASSES; p++) {
+      c[p * 256 + ((k >> (8 * p)) & 0xff)]++;
+    }
+  }
+
+  // The input range and one scratch buffer take turns as the destination.
+  // reserve leaves trivially constructible elements uninitialized.
+  vector<T> scratch;
+  scratch.reserve(n);
+  T* buffer = scratch.data();
+  auto scatter = [&](auto src, auto dst, size_t* bucket, size_t p) {
+    for (size_t i = 0; i < n; i++) {
+      U k = detail::radix_key(key(src[i]));
+      dst[bucket[(k >> (8 * p)) & 0xff]++] = std::move(src[i]);
+    }
+  };
+
+  bool in_buffer = false;
+  for (size_t p = 0; p < PASSES; p++) {
+    size_t* bucket = c + p * 256;
+
+    // Every key has the same byte here, this pass would change nothing.
+    bool trivial = false;
+    for (size_t d = 0; d < 256; d++) {
+      if (bucket[d] == n) trivial = true;
+    }
+    if (trivial) continue;
+
+    size_t offset = 0;
+    for (size_t d = 0; d < 256; d++) {
+      size_t count = bucket[d];
+      bucket[d] = offset;
+      offset += count;
+    }
+    if (in_buffer)
+      scatter(buffer, first, bucket, p);
+    else
+      scatter(first, buffer, bucket, p);
+    in_buffer = !in_buffer;
+  }
+
+  // An odd number of passes left the result in the buffer.
+  if (in_buffer) {
+    for (size_t i = 0; i < n; i++) {
+      first[i] = std::move(buffer[i]);
+    }
+  }
+}
+
+template <class RandomIt>
+void radix_sort(RandomIt first, RandomIt last) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  if constexpr (std::is_same_v<T, string>) {
+    detail::string_radix_sort(first, last);
+  } else {
+    radix_sort(first, last, detail::identity_key());
+  }
+}
+
+template <class RandomIt, class Compare>
+void parallel_sort(RandomIt first, RandomIt last, Compare comp,
+                   size_t threads) {
+  size_t n = last - first;
+  if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+  // Keep every chunk worth the cost of a thread.
+  threads = std::min(threads, n / detail::PARALLEL_SORT_THRESHOLD);
+  if (threads <= 1) {
+    tjs::sort(first, last, comp);
+    return;
+  }
+
+  vector<size_t> bounds(threads + 1);
+  size_t* b = bounds.data();
+  for (size_t i = 0; i <= threads; i++) {
+    b[i] = n * i / threads;
+  }
+
+  vector<std::thread> workers(threads);
+  std::thread* w = workers.data();
+  for (size_t i = 0; i < threads; i++) {
+    w[i] = std::thread([first, b, i, comp] {
+      tjs::sort(first + b[i], first + b[i + 1], comp);
+    });
+  }
+  for (size_t i = 0; i < threads; i++) w[i].join();
+
+  // Merge neighbouring runs, doubling the run length each round.
+  for (size_t width = 1; width < threads; width <<= 1) {
+    size_t used = 0;
+    for (size_t i = 0; i + width < threads; i += 2 * width) {
+      size_t lo = b[i];
+      size_t mid = b[i + width];
+      size_t hi = b[std::min(i + 2 * width, threads)];
+      w[used++] = std::thread([first, lo, mid, hi, comp] {
+        std::inplace_merge(first + lo, first + mid, first + hi, comp);
+      });
+    }
+    for (size_t i = 0; i < used; i++) w[i].join();
+  }
+}
+
+}  // namespace tjs
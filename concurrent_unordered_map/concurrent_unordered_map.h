@@ -0,0 +1,115 @@
+#ifndef TJS_CONCURRENT_UNORDERED_MAP_H
+#define TJS_CONCURRENT_UNORDERED_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+#include "vector/vector.h"
+
+namespace tjs {
+
+// A hash map split into independently locked shards. Each shard is an open
+// addressing (linear probing) table stored in a tjs::vector, guarded by its
+// own reader/writer lock, so readers never block each other and a writer
+// only blocks the one shard it touches. Shards grow independently, so a
+// resize never stops the whole map.
+//
+// Values are never handed out by reference (another thread could erase
+// them), lookups either copy the value out or run a visitor under the lock.
+// K and V must be default constructible, like any tjs::vector element.
+template <class K, class V, class Hash = std::hash<K>,
+          class KeyEqual = std::equal_to<K>>
+class concurrent_unordered_map {
+  // ------------------------------------------------------------------------
+  // MEMBER TYPES
+  // ------------------------------------------------------------------------
+  enum slot_state : uint8_t { EMPTY, FULL, TOMBSTONE };
+
+  struct slot {
+    K key{};
+    V value{};
+    slot_state state = EMPTY;
+  };
+
+  // Shards sit on their own cache lines so their locks don't false share.
+  struct alignas(64) shard {
+    mutable std::shared_mutex mutex;
+    vector<slot> slots;  // Capacity is always a power of two.
+    size_t size = 0;     // FULL slots.
+    size_t used = 0;     // FULL and TOMBSTONE slots.
+  };
+
+  // ------------------------------------------------------------------------
+  // MEMBER VARIABLES
+  // ------------------------------------------------------------------------
+  vector<shard> m_shards;
+  size_t m_shard_mask;
+  Hash m_hash;
+  KeyEqual m_equal;
+
+  static constexpr size_t npos = static_cast<size_t>(-1);
+
+  // ------------------------------------------------------------------------
+  // PRIVATE MEMBER FUNCTIONS
+  // ------------------------------------------------------------------------
+  static size_t round_up_pow2(size_t n);
+  uint64_t hash_of(const K& key) const;
+  shard& shard_for(uint64_t h);
+  const shard& shard_for(uint64_t h) const;
+
+  size_t find_index(const shard& s, const K& key, uint64_t h) const;
+  void reserve_shard(shard& s, size_t extra);
+  void rehash_shard(shard& s, size_t new_cap);
+  template <class U>
+  bool emplace_locked(shard& s, const K& key, uint64_t h, U&& value,
+                      bool assign);
+
+ public:
+  // ------------------------------------------------------------------------
+  // Big 5
+  // ------------------------------------------------------------------------
+  explicit concurrent_unordered_map(size_t shard_count = 64,
+                                    size_t shard_capacity = 16);
+  ~concurrent_unordered_map() = default;
+
+  // Shards own mutexes, so the map can be neither copied nor moved.
+  concurrent_unordered_map(const concurrent_unordered_map&) = delete;
+  concurrent_unordered_map& operator=(const concurrent_unordered_map&) =
+      delete;
+
+  // ------------------------------------------------------------------------
+  // Public Member Functions
+  // ------------------------------------------------------------------------
+  // Inserts if the key is absent. Returns whether it inserted.
+  bool insert(const K& key, const V& value);
+
+  // Inserts or overwrites. Returns true if the key was new.
+  bool insert_or_assign(const K& key, const V& value);
+
+  // Applies a whole batch, taking each shard's lock once.
+  void insert_or_assign(const vector<std::pair<K, V>>& batch);
+
+  bool erase(const K& key);
+  void clear();
+
+  std::optional<V> find(const K& key) const;
+  bool contains(const K& key) const;
+
+  // Calls f(const V&) under the shard's read lock if the key is present.
+  template <class F>
+  bool visit(const K& key, F&& f) const;
+
+  // Sums every shard; only exact when no writer is running.
+  size_t size() const;
+  bool empty() const;
+  size_t shard_count() const;
+};
+
+}  // namespace tjs
+
+#include "concurrent_unordered_map.tpp"
+#endif  // TJS_CONCURRENT_UNORDERED_MAP_H
@@ -0,0 +1,280 @@
+#include <mutex>
+
+#include "concurrent_unordered_map.h"
+
+namespace tjs {
+
+// ------------------------------------------------------------------------
+// PRIVATE MEMBER FUNCTIONS
+// ------------------------------------------------------------------------
+
+template <class K, class V, class Hash, class KeyEqual>
+size_t concurrent_unordered_map<K, V, Hash, KeyEqual>::round_up_pow2(
+    size_t n) {
+  size_t power = 1;
+  while (power < n) power <<= 1;
+  return power;
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+uint64_t concurrent_unordered_map<K, V, Hash, KeyEqual>::hash_of(
+    const K& key) const {
+  // std::hash is the identity for integers, so mix the bits (splitmix64
+  // finalizer) before using low bits for slots and high bits for shards.
+  uint64_t h = static_cast<uint64_t>(m_hash(key));
+  h ^= h >> 30;
+  h *= 0xbf58476d1ce4e5b9ULL;
+  h ^= h >> 27;
+  h *= 0x94d049bb133111ebULL;
+  h ^= h >> 31;
+  return h;
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+typename concurrent_unordered_map<K, V, Hash, KeyEqual>::shard&
+concurrent_unordered_map<K, V, Hash, KeyEqual>::shard_for(uint64_t h) {
+  return m_shards.data()[(h >> 40) & m_shard_mask];
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+const typename concurrent_unordered_map<K, V, Hash, KeyEqual>::shard&
+concurrent_unordered_map<K, V, Hash, KeyEqual>::shard_for(uint64_t h) const {
+  return m_shards.data()[(h >> 40) & m_shard_mask];
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+size_t concurrent_unordered_map<K, V, Hash, KeyEqual>::find_index(
+    const shard& s, const K& key, uint64_t h) const {
+  const slot* slots = s.slots.data();
+  size_t mask = s.slots.size() - 1;
+  // The load factor cap guarantees an EMPTY slot ends every probe.
+  for (size_t i = h & mask;; i = (i + 1) & mask) {
+    if (slots[i].state == EMPTY) return npos;
+    if (slots[i].state == FULL && m_equal(slots[i].key, key)) return i;
+  }
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+void concurrent_unordered_map<K, V, Hash, KeyEqual>::reserve_shard(
+    shard& s, size_t extra) {
+  size_t cap = s.slots.size();
+  // Keep FULL + TOMBSTONE slots at or below 3/4 of the table.
+  if ((s.used + extra) * 4 <= cap * 3) return;
+
+  // Tombstones are dropped on rehash, so only live entries count here.
+  size_t new_cap = cap;
+  while ((s.size + extra) * 4 > new_cap * 3) new_cap <<= 1;
+  rehash_shard(s, new_cap);
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+void concurrent_unordered_map<K, V, Hash, KeyEqual>::rehash_shard(
+    shard& s, size_t new_cap) {
+  vector<slot> fresh(new_cap);
+  slot* dst = fresh.data();
+  size_t mask = new_cap - 1;
+
+  slot* src = s.slots.data();
+  for (size_t i = 0; i < s.slots.size(); i++) {
+    if (src[i].state != FULL) continue;
+    size_t j = hash_of(src[i].key) & mask;
+    while (dst[j].state != EMPTY) j = (j + 1) & mask;
+    dst[j].key = std::move(src[i].key);
+    dst[j].value = std::move(src[i].value);
+    dst[j].state = FULL;
+  }
+  s.slots = std::move(fresh);
+  s.used = s.size;
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+template <class U>
+bool concurrent_unordered_map<K, V, Hash, KeyEqual>::emplace_locked(
+    shard& s, const K& key, uint64_t h, U&& value, bool assign) {
+  reserve_shard(s, 1);
+
+  slot* slots = s.slots.data();
+  size_t mask = s.slots.size() - 1;
+  size_t tombstone = npos;
+  size_t i = h & mask;
+  for (;; i = (i + 1) & mask) {
+    if (slots[i].state == EMPTY) break;
+    if (slots[i].state == TOMBSTONE) {
+      if (tombstone == npos) tombstone = i;
+    } else if (m_equal(slots[i].key, key)) {
+      if (assign) slots[i].value = std::forward<U>(value);
+      return false;
+    }
+  }
+
+  // Reuse the first tombstone on the probe path when there is one.
+  if (tombstone != npos) {
+    i = tombstone;
+  } else {
+    s.used++;
+  }
+  slots[i].key = key;
+  slots[i].value = std::forward<U>(value);
+  slots[i].state = FULL;
+  s.size++;
+  return true;
+}
+
+// ------------------------------------------------------------------------
+// Big 5
+// ------------------------------------------------------------------------
+
+template <class K, class V, class Hash, class KeyEqual>
+concurrent_unordered_map<K, V, Hash, KeyEqual>::concurrent_unordered_map(
+    size_t shard_count, size_t shard_capacity)
+    : m_shards(round_up_pow2(shard_count)),
+      m_shard_mask(m_shards.size() - 1) {
+  size_t cap = round_up_pow2(shard_capacity < 2 ? 2 : shard_capacity);
+  for (size_t i = 0; i < m_shards.size(); i++) {
+    m_shards[i].slots = vector<slot>(cap);
+  }
+}
+
+// ------------------------------------------------------------------------
+// Public Member Functions
+// ------------------------------------------------------------------------
+
+template <class K, class V, class Hash, class KeyEqual>
+bool concurrent_unordered_map<K, V, Hash, KeyEqual>::insert(const K& key,
+                                                            const V& value) {
+  uint64_t h = hash_of(key);
+  shard& s = shard_for(h);
+  std::unique_lock<std::shared_mutex> lock(s.mutex);
+  return emplace_locked(s, key, h, value, false);
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+bool concurrent_unordered_map<K, V, Hash, KeyEqual>::insert_or_assign(
+    const K& key, const V& value) {
+  uint64_t h = hash_of(key);
+  shard& s = shard_for(h);
+  std::unique_lock<std::shared_mutex> lock(s.mutex);
+  return emplace_locked(s, key, h, value, true);
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+void concurrent_unordered_map<K, V, Hash, KeyEqual>::insert_or_assign(
+    const vector<std::pair<K, V>>& batch) {
+  size_t n = batch.size();
+  size_t shards = m_shards.size();
+  const std::pair<K, V>* items = batch.data();
+
+  // Counting sort the batch by shard so every shard is locked (and grown)
+  // at most once.
+  vector<uint64_t> hashes(n);
+  vector<size_t> starts(shards + 1);
+  for (size_t i = 0; i < n; i++) {
+    hashes.data()[i] = hash_of(items[i].first);
+    starts.data()[((hashes.data()[i] >> 40) & m_shard_mask) + 1]++;
+  }
+  for (size_t i = 0; i < shards; i++) {
+    starts.data()[i + 1] += starts.data()[i];
+  }
+  vector<size_t> order(n);
+  vector<size_t> fill(shards);
+  for (size_t i = 0; i < n; i++) {
+    size_t sh = (hashes.data()[i] >> 40) & m_shard_mask;
+    order.data()[starts.data()[sh] + fill.data()[sh]++] = i;
+  }
+
+  for (size_t sh = 0; sh < shards; sh++) {
+    size_t first = starts.data()[sh];
+    size_t last = starts.data()[sh + 1];
+    if (first == last) continue;
+
+    shard& s = m_shards.data()[sh];
+    std::unique_lock<std::shared_mutex> lock(s.mutex);
+    reserve_shard(s, last - first);
+    for (size_t k = first; k < last; k++) {
+      size_t i = order.data()[k];
+      emplace_locked(s, items[i].first, hashes.data()[i], items[i].second,
+                     true);
+    }
+  }
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+bool concurrent_unordered_map<K, V, Hash, KeyEqual>::erase(const K& key) {
+  uint64_t h = hash_of(key);
+  shard& s = shard_for(h);
+  std::unique_lock<std::shared_mutex> lock(s.mutex);
+  size_t i = find_index(s, key, h);
+  if (i == npos) return false;
+
+  // Leave a tombstone so later probes keep walking past this slot.
+  slot& sl = s.slots.data()[i];
+  sl.key = K();
+  sl.value = V();
+  sl.state = TOMBSTONE;
+  s.size--;
+  return true;
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+void concurrent_unordered_map<K, V, Hash, KeyEqual>::clear() {
+  for (size_t sh = 0; sh < m_shards.size(); sh++) {
+    shard& s = m_shards.data()[sh];
+    std::unique_lock<std::shared_mutex> lock(s.mutex);
+    s.slots = vector<slot>(s.slots.size());
+    s.size = 0;
+    s.used = 0;
+  }
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+std::optional<V> concurrent_unordered_map<K, V, Hash, KeyEqual>::find(
+    const K& key) const {
+  std::optional<V> out;
+  visit(key, [&out](const V& value) { out = value; });
+  return out;
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+bool concurrent_unordered_map<K, V, Hash, KeyEqual>::contains(
+    const K& key) const {
+  uint64_t h = hash_of(key);
+  const shard& s = shard_for(h);
+  std::shared_lock<std::shared_mutex> lock(s.mutex);
+  return find_index(s, key, h) != npos;
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+template <class F>
+bool concurrent_unordered_map<K, V, Hash, KeyEqual>::visit(const K& key,
+                                                           F&& f) const {
+  uint64_t h = hash_of(key);
+  const shard& s = shard_for(h);
+  std::shared_lock<std::shared_mutex> lock(s.mutex);
+  size_t i = find_index(s, key, h);
+  if (i == npos) return false;
+  f(static_cast<const V&>(s.slots.data()[i].value));
+  return true;
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+size_t concurrent_unordered_map<K, V, Hash, KeyEqual>::size() const {
+  size_t total = 0;
+  for (size_t sh = 0; sh < m_shards.size(); sh++) {
+    const shard& s = m_shards.data()[sh];
+    std::shared_lock<std::shared_mutex> lock(s.mutex);
+    total += s.size;
+  }
+  return total;
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+bool concurrent_unordered_map<K, V, Hash, KeyEqual>::empty() const {
+  return size() == 0;
+}
+
+template <class K, class V, class Hash, class KeyEqual>
+size_t concurrent_unordered_map<K, V, Hash, KeyEqual>::shard_count() const {
+  return m_shards.size();
+}
+
+}  // namespace tjs
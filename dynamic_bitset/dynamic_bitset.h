@@ -0,0 +1,112 @@
+#ifndef TJS_DYNAMIC_BITSET_H
+#define TJS_DYNAMIC_BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+#include "vector/vector.h"
+
+namespace tjs {
+
+// A runtime sized set of bits packed into 64 bit words. Bulk operations
+// work a word at a time in plain loops the compiler can vectorize, and
+// count uses the popcnt instruction when the CPU has it (picked at
+// runtime on x86-64) and find uses the count-trailing-zeros builtin.
+// Bits past size() are always kept zero.
+class dynamic_bitset {
+ public:
+  using word_type = uint64_t;
+  static constexpr size_t WORD_BITS = 64;
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+ private:
+  // ------------------------------------------------------------------------
+  // MEMBER VARIABLES
+  // ------------------------------------------------------------------------
+  size_t m_size = 0;            // How many bits are in the set.
+  size_t m_word_count = 0;      // words_for(m_size) words in use.
+  size_t m_word_capacity = 0;   // Words allocated.
+  word_type* m_words = nullptr;  // Underlying word array.
+
+  // ------------------------------------------------------------------------
+  // PRIVATE MEMBER FUNCTIONS
+  // ------------------------------------------------------------------------
+  static size_t words_for(size_t bits);
+  void check_index(size_t i) const;
+  void check_same_size(const dynamic_bitset& o) const;
+  void clear_unused_bits();
+  void change_capacity(size_t words);
+
+ public:
+  // ------------------------------------------------------------------------
+  // Big 5
+  // ------------------------------------------------------------------------
+  dynamic_bitset();
+  explicit dynamic_bitset(size_t n, bool value = false);
+  dynamic_bitset(const dynamic_bitset& other);
+  dynamic_bitset(dynamic_bitset&& other);
+  dynamic_bitset& operator=(const dynamic_bitset& other);
+  dynamic_bitset& operator=(dynamic_bitset&& other);
+  ~dynamic_bitset();
+
+  // ------------------------------------------------------------------------
+  // Public Member Functions
+  // ------------------------------------------------------------------------
+  size_t size() const;
+  bool empty() const;
+  size_t word_count() const;
+  word_type* data();
+  const word_type* data() const;
+
+  // resize allocates exactly the words needed; push_back grows the word
+  // array geometrically.
+  void resize(size_t n, bool value = false);
+  void push_back(bool value);
+
+  // Single bit access, bounds checked.
+  bool test(size_t i) const;
+  bool operator[](size_t i) const;
+  dynamic_bitset& set(size_t i, bool value = true);
+  dynamic_bitset& reset(size_t i);
+  dynamic_bitset& flip(size_t i);
+
+  // Whole set.
+  dynamic_bitset& set();
+  dynamic_bitset& reset();
+  dynamic_bitset& flip();
+
+  // Word parallel logic, both sets must be the same size.
+  dynamic_bitset& operator&=(const dynamic_bitset& o);
+  dynamic_bitset& operator|=(const dynamic_bitset& o);
+  dynamic_bitset& operator^=(const dynamic_bitset& o);
+  dynamic_bitset& and_not(const dynamic_bitset& o);  // *this &= ~o
+  dynamic_bitset operator~() const;
+
+  size_t count() const;
+  bool any() const;
+  bool none() const;
+  bool all() const;
+
+  // Index of the first set bit, or of the first set bit after pos.
+  // Both return npos when there is none.
+  size_t find_first() const;
+  size_t find_next(size_t pos) const;
+
+  bool operator==(const dynamic_bitset& o) const;
+  bool operator!=(const dynamic_bitset& o) const;
+
+  // Output operator overload.
+  friend std::ostream& operator<<(std::ostream& os, const dynamic_bitset& bs);
+};
+
+dynamic_bitset operator&(const dynamic_bitset& a, const dynamic_bitset& b);
+dynamic_bitset operator|(const dynamic_bitset& a, const dynamic_bitset& b);
+dynamic_bitset operator^(const dynamic_bitset& a, const dynamic_bitset& b);
+
+}  // namespace tjs
+
+#include "dynamic_bitset.tpp"
+#endif  // TJS_DYNAMIC_BITSET_H
@@ -0,0 +1,348 @@
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "dynamic_bitset.h"
+
+namespace tjs {
+
+// ------------------------------------------------------------------------
+// PRIVATE MEMBER FUNCTIONS
+// ------------------------------------------------------------------------
+
+inline size_t dynamic_bitset::words_for(size_t bits) {
+  return (bits + WORD_BITS - 1) / WORD_BITS;
+}
+
+inline void dynamic_bitset::check_index(size_t i) const {
+  if (i >= m_size)
+    throw std::out_of_range("Bit " + std::to_string(i) +
+                            " is out of range, bitset has " +
+                            std::to_string(m_size) + " bits.");
+}
+
+inline void dynamic_bitset::check_same_size(const dynamic_bitset& o) const {
+  if (m_size != o.m_size)
+    throw std::invalid_argument("Bitset sizes differ: " +
+                                std::to_string(m_size) + " and " +
+                                std::to_string(o.m_size) + ".");
+}
+
+inline void dynamic_bitset::clear_unused_bits() {
+  size_t tail = m_size % WORD_BITS;
+  if (tail != 0) {
+    m_words[m_word_count - 1] &= (word_type(1) << tail) - 1;
+  }
+}
+
+inline void dynamic_bitset::change_capacity(size_t words) {
+  word_type* fresh = words == 0 ? nullptr : new word_type[words]();
+  size_t keep = std::min(words, m_word_count);
+  if (keep > 0) std::memcpy(fresh, m_words, keep * sizeof(word_type));
+  delete[] m_words;
+  m_words = fresh;
+  m_word_capacity = words;
+}
+
+// ------------------------------------------------------------------------
+// Big 5
+// ------------------------------------------------------------------------
+
+inline dynamic_bitset::dynamic_bitset() : m_size(0) {}
+
+inline dynamic_bitset::dynamic_bitset(size_t n, bool value)
+    : m_size(n),
+      m_word_count(words_for(n)),
+      m_word_capacity(m_word_count),
+      m_words(m_word_count == 0 ? nullptr : new word_type[m_word_count]()) {
+  if (value) set();
+}
+
+inline dynamic_bitset::dynamic_bitset(const dynamic_bitset& other)
+    : m_size(other.m_size),
+      m_word_count(other.m_word_count),
+      m_word_capacity(other.m_word_count),
+      m_words(m_word_count == 0 ? nullptr : new word_type[m_word_count]) {
+  if (m_word_count > 0)
+    std::memcpy(m_words, other.m_words, m_word_count * sizeof(word_type));
+}
+
+inline dynamic_bitset::dynamic_bitset(dynamic_bitset&& other)
+    : m_size(other.m_size),
+      m_word_count(other.m_word_count),
+      m_word_capacity(other.m_word_capacity),
+      m_words(other.m_words) {
+  other.m_size = 0;
+  other.m_word_count = 0;
+  other.m_word_capacity = 0;
+  other.m_words = nullptr;
+}
+
+inline dynamic_bitset& dynamic_bitset::operator=(const dynamic_bitset& other) {
+  if (this != &other) {
+    // Reuse our words when they fit.
+    if (m_word_capacity < other.m_word_count) {
+      delete[] m_words;
+      m_words = new word_type[other.m_word_count];
+      m_word_capacity = other.m_word_count;
+    }
+    m_size = other.m_size;
+    m_word_count = other.m_word_count;
+    if (m_word_count > 0)
+      std::memcpy(m_words, other.m_words, m_word_count * sizeof(word_type));
+  }
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::operator=(dynamic_bitset&& other) {
+  if (this != &other) {
+    delete[] m_words;
+    m_size = other.m_size;
+    m_word_count = other.m_word_count;
+    m_word_capacity = other.m_word_capacity;
+    m_words = other.m_words;
+    other.m_size = 0;
+    other.m_word_count = 0;
+    other.m_word_capacity = 0;
+    other.m_words = nullptr;
+  }
+  return *this;
+}
+
+inline dynamic_bitset::~dynamic_bitset() { delete[] m_words; }
+
+// ------------------------------------------------------------------------
+// Public Member Functions
+// ------------------------------------------------------------------------
+
+inline size_t dynamic_bitset::size() const { return m_size; }
+
+inline bool dynamic_bitset::empty() const { return m_size == 0; }
+
+inline size_t dynamic_bitset::word_count() const { return m_word_count; }
+
+inline dynamic_bitset::word_type* dynamic_bitset::data() {
+  return m_words;
+}
+
+inline const dynamic_bitset::word_type* dynamic_bitset::data() const {
+  return m_words;
+}
+
+inline void dynamic_bitset::resize(size_t n, bool value) {
+  size_t old_size = m_size;
+  size_t words = words_for(n);
+  // Exactly as many words as needed; only push_back grows geometrically.
+  if (words != m_word_capacity) change_capacity(words);
+  if (words > m_word_count) {
+    std::memset(m_words + m_word_count, 0,
+                (words - m_word_count) * sizeof(word_type));
+  }
+  m_word_count = words;
+  m_size = n;
+  if (value && n > old_size) {
+    // Fill the partial word bit by bit, then whole words at once.
+    size_t i = old_size;
+    for (; i < n && i % WORD_BITS != 0; i++) set(i);
+    word_type* w = m_words;
+    for (size_t k = words_for(i); k < words; k++) {
+      w[k] = ~word_type(0);
+    }
+  }
+  clear_unused_bits();
+}
+
+inline void dynamic_bitset::push_back(bool value) {
+  if (m_size % WORD_BITS == 0) {
+    if (m_word_count == m_word_capacity)
+      change_capacity(m_word_capacity == 0 ? 1 : 2 * m_word_capacity);
+    m_words[m_word_count++] = 0;
+  }
+  m_size++;
+  set(m_size - 1, value);
+}
+
+inline bool dynamic_bitset::test(size_t i) const {
+  check_index(i);
+  return (m_words[i / WORD_BITS] >> (i % WORD_BITS)) & 1;
+}
+
+inline bool dynamic_bitset::operator[](size_t i) const { return test(i); }
+
+inline dynamic_bitset& dynamic_bitset::set(size_t i, bool value) {
+  check_index(i);
+  word_type mask = word_type(1) << (i % WORD_BITS);
+  if (value)
+    m_words[i / WORD_BITS] |= mask;
+  else
+    m_words[i / WORD_BITS] &= ~mask;
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::reset(size_t i) {
+  return set(i, false);
+}
+
+inline dynamic_bitset& dynamic_bitset::flip(size_t i) {
+  check_index(i);
+  m_words[i / WORD_BITS] ^= word_type(1) << (i % WORD_BITS);
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::set() {
+  word_type* w = m_words;
+  size_t n = m_word_count;
+  for (size_t k = 0; k < n; k++) w[k] = ~word_type(0);
+  clear_unused_bits();
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::reset() {
+  word_type* w = m_words;
+  size_t n = m_word_count;
+  for (size_t k = 0; k < n; k++) w[k] = 0;
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::flip() {
+  word_type* w = m_words;
+  size_t n = m_word_count;
+  for (size_t k = 0; k < n; k++) w[k] = ~w[k];
+  clear_unused_bits();
+  return *this;
+}
+
+// ———— WORD PARALLEL LOGIC ————
+// Simple counted loops over raw word pointers, which GCC and Clang turn
+// into SIMD loads and stores. The bound is read once up front: a store
+// through a word pointer could alias the vector's size, and reloading it
+// every iteration stops vectorization. o may be *this, which is fine for
+// these element-wise loops.
+
+inline dynamic_bitset& dynamic_bitset::operator&=(const dynamic_bitset& o) {
+  check_same_size(o);
+  word_type* dst = m_words;
+  const word_type* src = o.m_words;
+  size_t n = m_word_count;
+  for (size_t k = 0; k < n; k++) dst[k] &= src[k];
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::operator|=(const dynamic_bitset& o) {
+  check_same_size(o);
+  word_type* dst = m_words;
+  const word_type* src = o.m_words;
+  size_t n = m_word_count;
+  for (size_t k = 0; k < n; k++) dst[k] |= src[k];
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::operator^=(const dynamic_bitset& o) {
+  check_same_size(o);
+  word_type* dst = m_words;
+  const word_type* src = o.m_words;
+  size_t n = m_word_count;
+  for (size_t k = 0; k < n; k++) dst[k] ^= src[k];
+  return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::and_not(const dynamic_bitset& o) {
+  check_same_size(o);
+  word_type* dst = m_words;
+  const word_type* src = o.m_words;
+  size_t n = m_word_count;
+  for (size_t k = 0; k < n; k++) dst[k] &= ~src[k];
+  return *this;
+}
+
+inline dynamic_bitset dynamic_bitset::operator~() const {
+  dynamic_bitset out(*this);
+  out.flip();
+  return out;
+}
+
+// ———— QUERIES ————
+inline size_t dynamic_bitset::count() const {
+  return detail::popcount_words(m_words, m_word_count);
+}
+
+inline bool dynamic_bitset::any() const {
+  const word_type* w = m_words;
+  size_t n = m_word_count;
+  for (size_t k = 0; k < n; k++) {
+    if (w[k] != 0) return true;
+  }
+  return false;
+}
+
+inline bool dynamic_bitset::none() const { return !any(); }
+
+inline bool dynamic_bitset::all() const { return count() == m_size; }
+
+inline size_t dynamic_bitset::find_first() const {
+  const word_type* w = m_words;
+  size_t n = m_word_count;
+  for (size_t k = 0; k < n; k++) {
+    if (w[k] != 0) return k * WORD_BITS + __builtin_ctzll(w[k]);
+  }
+  return npos;
+}
+
+inline size_t dynamic_bitset::find_next(size_t pos) const {
+  if (pos + 1 >= m_size) return npos;
+  size_t i = pos + 1;
+  const word_type* w = m_words;
+
+  // Mask off the bits at or before pos in the first word.
+  size_t k = i / WORD_BITS;
+  word_type word = w[k] & (~word_type(0) << (i % WORD_BITS));
+  while (true) {
+    if (word != 0) return k * WORD_BITS + __builtin_ctzll(word);
+    if (++k == m_word_count) return npos;
+    word = w[k];
+  }
+}
+
+inline bool dynamic_bitset::operator==(const dynamic_bitset& o) const {
+  if (m_size != o.m_size) return false;
+  return m_word_count == 0 ||
+         std::memcmp(m_words, o.m_words,
+                     m_word_count * sizeof(word_type)) == 0;
+}
+
+inline bool dynamic_bitset::operator!=(const dynamic_bitset& o) const {
+  return !(*this == o);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const dynamic_bitset& bs) {
+  // Bit 0 first, like the elements of a vector<bool>.
+  for (size_t i = 0; i < bs.m_size; i++) {
+    os << ((bs.m_words[i / dynamic_bitset::WORD_BITS] >>
+            (i % dynamic_bitset::WORD_BITS)) &
+           1);
+  }
+  return os;
+}
+
+inline dynamic_bitset operator&(const dynamic_bitset& a,
+                                const dynamic_bitset& b) {
+  dynamic_bitset out(a);
+  out &= b;
+  return out;
+}
+
+inline dynamic_bitset operator|(const dynamic_bitset& a,
+                                const dynamic_bitset& b) {
+  dynamic_bitset out(a);
+  out |= b;
+  return out;
+}
+
+inline dynamic_bitset operator^(const dynamic_bitset& a,
+                                const dynamic_bitset& b) {
+  dynamic_bitset out(a);
+  out ^= b;
+  return out;
+}
+
+}  // namespace tjs
@@ -0,0 +1,138 @@
+#ifndef TJS_INTRUSIVE_LIST_H
+#define TJS_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <iterator>
+
+namespace tjs {
+
+template <class T, class Tag>
+class intrusive_list;
+
+// ------------------------------------------------------------------------
+// Hook
+// ------------------------------------------------------------------------
+// Derive from intrusive_list_hook<Tag> to make a type linkable into an
+// intrusive_list<T, Tag>. Use a different Tag per list an object should be
+// able to sit in at the same time.
+//
+// A hook unlinks itself in O(1) without knowing its list, and does so
+// automatically when the object is destroyed. Copying an object never
+// copies its links.
+template <class Tag = void>
+class intrusive_list_hook {
+  intrusive_list_hook* m_prev = nullptr;
+  intrusive_list_hook* m_next = nullptr;
+
+  template <class, class>
+  friend class intrusive_list;
+
+ public:
+  intrusive_list_hook();
+  intrusive_list_hook(const intrusive_list_hook&);
+  intrusive_list_hook& operator=(const intrusive_list_hook&);
+  ~intrusive_list_hook();
+
+  bool is_linked() const;
+  void unlink();
+};
+
+// ------------------------------------------------------------------------
+// List
+// ------------------------------------------------------------------------
+// A circular doubly linked list of objects it does not own. Inserting never
+// allocates, and every splice is O(1). Because elements can unlink
+// themselves behind the list's back, size() walks the list (O(n)); use
+// empty() for the O(1) check.
+template <class T, class Tag = void>
+class intrusive_list {
+  using hook = intrusive_list_hook<Tag>;
+
+  // ------------------------------------------------------------------------
+  // MEMBER VARIABLES
+  // ------------------------------------------------------------------------
+  hook m_head;  // Sentinel, m_head.m_next is the front.
+
+  // ------------------------------------------------------------------------
+  // PRIVATE MEMBER FUNCTIONS
+  // ------------------------------------------------------------------------
+  void init_empty();
+  static void link_before(hook* pos, hook* h);
+
+ public:
+  // ------------------------------------------------------------------------
+  // Iterator
+  // ------------------------------------------------------------------------
+  class iterator {
+    hook* ptr_;
+
+    friend class intrusive_list;
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    iterator(hook* p = nullptr);
+    reference operator*() const;
+    pointer operator->() const;
+    iterator& operator++();
+    iterator operator++(int);
+    iterator& operator--();
+    iterator operator--(int);
+    bool operator==(const iterator& o) const;
+    bool operator!=(const iterator& o) const;
+  };
+
+  // ------------------------------------------------------------------------
+  // Big 5
+  // ------------------------------------------------------------------------
+  intrusive_list();
+  intrusive_list(intrusive_list&& other);
+  intrusive_list& operator=(intrusive_list&& other);
+  ~intrusive_list();
+
+  // The list doesn't own its elements, so it can't be copied.
+  intrusive_list(const intrusive_list&) = delete;
+  intrusive_list& operator=(const intrusive_list&) = delete;
+
+  // ------------------------------------------------------------------------
+  // Public Member Functions
+  // ------------------------------------------------------------------------
+  bool empty() const;
+  size_t size() const;
+
+  T& front();
+  T& back();
+
+  // Elements must not already be linked into a list with this Tag.
+  void push_front(T& elem);
+  void push_back(T& elem);
+  iterator insert(iterator pos, T& elem);
+
+  // Unlink without destroying. erase returns the element after it.
+  void pop_front();
+  void pop_back();
+  iterator erase(iterator pos);
+  void clear();
+
+  // Moves elements before pos. other may be *this; pos must not lie inside
+  // the moved range.
+  void splice(iterator pos, intrusive_list& other);
+  void splice(iterator pos, intrusive_list& other, iterator it);
+  void splice(iterator pos, intrusive_list& other, iterator first,
+              iterator last);
+
+  // Iterator to an element known to be in this list.
+  static iterator iterator_to(T& elem);
+
+  iterator begin();
+  iterator end();
+};
+
+}  // namespace tjs
+
+#include "intrusive_list.tpp"
+#endif  // TJS_INTRUSIVE_LIST_H
@@ -0,0 +1,270 @@
+#include "intrusive_list.h"
+
+namespace tjs {
+
+// ------------------------------------------------------------------------
+// Hook Implementations
+// ------------------------------------------------------------------------
+
+template <class Tag>
+intrusive_list_hook<Tag>::intrusive_list_hook() {}
+
+template <class Tag>
+intrusive_list_hook<Tag>::intrusive_list_hook(const intrusive_list_hook&) {}
+
+template <class Tag>
+intrusive_list_hook<Tag>& intrusive_list_hook<Tag>::operator=(
+    const intrusive_list_hook&) {
+  // Links belong to the object's place in a list, keep ours.
+  return *this;
+}
+
+template <class Tag>
+intrusive_list_hook<Tag>::~intrusive_list_hook() {
+  unlink();
+}
+
+template <class Tag>
+bool intrusive_list_hook<Tag>::is_linked() const {
+  return m_next != nullptr;
+}
+
+template <class Tag>
+void intrusive_list_hook<Tag>::unlink() {
+  if (m_next == nullptr) return;
+  m_prev->m_next = m_next;
+  m_next->m_prev = m_prev;
+  m_prev = nullptr;
+  m_next = nullptr;
+}
+
+// ------------------------------------------------------------------------
+// PRIVATE MEMBER FUNCTIONS
+// ------------------------------------------------------------------------
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::init_empty() {
+  m_head.m_prev = &m_head;
+  m_head.m_next = &m_head;
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::link_before(hook* pos, hook* h) {
+  h->m_prev = pos->m_prev;
+  h->m_next = pos;
+  pos->m_prev->m_next = h;
+  pos->m_prev = h;
+}
+
+// ------------------------------------------------------------------------
+// Big 5
+// ------------------------------------------------------------------------
+
+template <class T, class Tag>
+intrusive_list<T, Tag>::intrusive_list() {
+  init_empty();
+}
+
+template <class T, class Tag>
+intrusive_list<T, Tag>::intrusive_list(intrusive_list&& other) {
+  init_empty();
+  splice(end(), other);
+}
+
+template <class T, class Tag>
+intrusive_list<T, Tag>& intrusive_list<T, Tag>::operator=(
+    intrusive_list&& other) {
+  if (this != &other) {
+    clear();
+    splice(end(), other);
+  }
+  return *this;
+}
+
+template <class T, class Tag>
+intrusive_list<T, Tag>::~intrusive_list() {
+  clear();
+}
+
+// ------------------------------------------------------------------------
+// Public Member Functions
+// ------------------------------------------------------------------------
+
+template <class T, class Tag>
+bool intrusive_list<T, Tag>::empty() const {
+  return m_head.m_next == &m_head;
+}
+
+template <class T, class Tag>
+size_t intrusive_list<T, Tag>::size() const {
+  size_t n = 0;
+  for (const hook* h = m_head.m_next; h != &m_head; h = h->m_next) n++;
+  return n;
+}
+
+template <class T, class Tag>
+T& intrusive_list<T, Tag>::front() {
+  return *begin();
+}
+
+template <class T, class Tag>
+T& intrusive_list<T, Tag>::back() {
+  return *--end();
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::push_front(T& elem) {
+  link_before(m_head.m_next, static_cast<hook*>(&elem));
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::push_back(T& elem) {
+  link_before(&m_head, static_cast<hook*>(&elem));
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::insert(
+    iterator pos, T& elem) {
+  hook* h = static_cast<hook*>(&elem);
+  link_before(pos.ptr_, h);
+  return iterator(h);
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::pop_front() {
+  m_head.m_next->unlink();
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::pop_back() {
+  m_head.m_prev->unlink();
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::erase(
+    iterator pos) {
+  hook* next = pos.ptr_->m_next;
+  pos.ptr_->unlink();
+  return iterator(next);
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::clear() {
+  hook* h = m_head.m_next;
+  while (h != &m_head) {
+    hook* next = h->m_next;
+    h->m_prev = nullptr;
+    h->m_next = nullptr;
+    h = next;
+  }
+  init_empty();
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::splice(iterator pos, intrusive_list& other) {
+  splice(pos, other, other.begin(), other.end());
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::splice(iterator pos, intrusive_list& other,
+                                    iterator it) {
+  iterator last = it;
+  splice(pos, other, it, ++last);
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::splice(iterator pos, intrusive_list&,
+                                    iterator first, iterator last) {
+  // Moving a range in front of itself (or its end) changes nothing.
+  if (first == last || pos == first || pos == last) return;
+  hook* f = first.ptr_;
+  hook* l = last.ptr_->m_prev;  // Last element that moves.
+
+  // Cut [f, l] out of its ring.
+  f->m_prev->m_next = last.ptr_;
+  last.ptr_->m_prev = f->m_prev;
+
+  // Stitch it in before pos.
+  hook* p = pos.ptr_;
+  f->m_prev = p->m_prev;
+  l->m_next = p;
+  p->m_prev->m_next = f;
+  p->m_prev = l;
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::iterator_to(
+    T& elem) {
+  return iterator(static_cast<hook*>(&elem));
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::begin() {
+  return iterator(m_head.m_next);
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::end() {
+  return iterator(&m_head);
+}
+
+// ------------------------------------------------------------------------
+// Iterator Implementations
+// ------------------------------------------------------------------------
+
+template <class T, class Tag>
+intrusive_list<T, Tag>::iterator::iterator(hook* p) : ptr_(p) {}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator::reference
+intrusive_list<T, Tag>::iterator::operator*() const {
+  return *static_cast<T*>(ptr_);
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator::pointer
+intrusive_list<T, Tag>::iterator::operator->() const {
+  return static_cast<T*>(ptr_);
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator&
+intrusive_list<T, Tag>::iterator::operator++() {
+  ptr_ = ptr_->m_next;
+  return *this;
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator
+intrusive_list<T, Tag>::iterator::operator++(int) {
+  iterator tmp(*this);
+  ptr_ = ptr_->m_next;
+  return tmp;
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator&
+intrusive_list<T, Tag>::iterator::operator--() {
+  ptr_ = ptr_->m_prev;
+  return *this;
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator
+intrusive_list<T, Tag>::iterator::operator--(int) {
+  iterator tmp(*this);
+  ptr_ = ptr_->m_prev;
+  return tmp;
+}
+
+template <class T, class Tag>
+bool intrusive_list<T, Tag>::iterator::operator==(const iterator& o) const {
+  return ptr_ == o.ptr_;
+}
+
+template <class T, class Tag>
+bool intrusive_list<T, Tag>::iterator::operator!=(const iterator& o) const {
+  return ptr_ != o.ptr_;
+}
+
+}  // namespace tjs
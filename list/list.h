@@ -0,0 +1,187 @@
+#ifndef TJS_LIST_H
+#define TJS_LIST_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "intrusive_list/intrusive_list.h"
+#include "vector/vector.h"
+
+namespace tjs {
+
+// A doubly linked list whose nodes come from a pool. Nodes are carved out
+// of geometrically growing blocks, and erased nodes go on the pool's free
+// list for reuse, so steady insert/erase churn doesn't allocate. Linking is
+// done by an intrusive_list over the nodes.
+//
+// Each list gets its own pool unless it is constructed with a node_pool
+// handle, in which case every list built from that handle draws from the
+// same pool. Splicing relinks nodes in O(1) and keeps iterators valid, so
+// it is only allowed between lists that share a pool, the way std::list
+// splice requires equal allocators. A pool lives until the last list and
+// handle referencing it are gone. Pools are not thread safe, so lists
+// sharing one must stay on one thread.
+template <class T>
+class list {
+  // ------------------------------------------------------------------------
+  // MEMBER TYPES
+  // ------------------------------------------------------------------------
+  struct node : intrusive_list_hook<> {
+    T value;
+
+    template <typename... Args>
+    explicit node(std::in_place_t, Args&&... args);
+  };
+
+  // Raw storage for one node, doubling as a free list link while unused.
+  union slot {
+    slot* next_free;
+    alignas(node) unsigned char bytes[sizeof(node)];
+  };
+
+  // Blocks of slots, freed once no list or handle references the pool.
+  struct pool {
+    static constexpr size_t FIRST_BLOCK = 16;
+    static constexpr size_t MAX_BLOCK = 4096;
+
+    size_t refs = 1;
+    size_t next_block = FIRST_BLOCK;
+    vector<slot*> blocks;
+    slot* cursor = nullptr;  // Next never used slot in the newest block.
+    slot* limit = nullptr;
+    slot* free = nullptr;    // Erased nodes, reused before the blocks.
+
+    ~pool();
+  };
+
+  // ------------------------------------------------------------------------
+  // MEMBER VARIABLES
+  // ------------------------------------------------------------------------
+  intrusive_list<node> m_nodes;
+  size_t m_size = 0;
+  pool* m_pool = nullptr;  // Created on first insert unless given one.
+
+  // ------------------------------------------------------------------------
+  // PRIVATE MEMBER FUNCTIONS
+  // ------------------------------------------------------------------------
+  slot* allocate_slot();
+  template <typename... Args>
+  node* create_node(Args&&... args);
+  void destroy_node(node* n);
+  bool shares_pool_with(const list& other) const;
+  void check_shared_pool(const list& other) const;
+  void release_pool();
+
+ public:
+  // ------------------------------------------------------------------------
+  // Node Pool
+  // ------------------------------------------------------------------------
+  // A reference counted handle to a pool. Lists constructed from the same
+  // handle (or from a list's get_pool()) share nodes and splice in O(1).
+  class node_pool {
+    pool* m_pool;
+
+    friend class list;
+    explicit node_pool(pool* p);
+
+   public:
+    node_pool();
+    node_pool(const node_pool& other);
+    node_pool& operator=(const node_pool& other);
+    ~node_pool();
+
+    // Lists and handles currently referencing the pool.
+    size_t use_count() const;
+
+    bool operator==(const node_pool& o) const;
+    bool operator!=(const node_pool& o) const;
+  };
+
+  // ------------------------------------------------------------------------
+  // Iterator
+  // ------------------------------------------------------------------------
+  class iterator {
+    typename intrusive_list<node>::iterator it_;
+
+    friend class list;
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    iterator() = default;
+    iterator(typename intrusive_list<node>::iterator it);
+    reference operator*() const;
+    pointer operator->() const;
+    iterator& operator++();
+    iterator operator++(int);
+    iterator& operator--();
+    iterator operator--(int);
+    bool operator==(const iterator& o) const;
+    bool operator!=(const iterator& o) const;
+  };
+
+  // ------------------------------------------------------------------------
+  // Big 5
+  // ------------------------------------------------------------------------
+  list();
+  explicit list(const node_pool& shared);
+  list(std::initializer_list<T> l);
+  list(const list& other);
+  list(list&& other);
+  list& operator=(const list& other);
+  list& operator=(list&& other);
+  ~list();
+
+  // ------------------------------------------------------------------------
+  // Public Member Functions
+  // ------------------------------------------------------------------------
+  size_t size() const;
+  bool empty() const;
+
+  T& front();
+  T& back();
+
+  void push_back(const T& elem);
+  void push_front(const T& elem);
+  template <typename... Args>
+  T& emplace_back(Args&&... args);
+  template <typename... Args>
+  T& emplace_front(Args&&... args);
+  iterator insert(iterator pos, const T& elem);
+  template <typename... Args>
+  iterator emplace(iterator pos, Args&&... args);
+
+  void pop_back();
+  void pop_front();
+  iterator erase(iterator pos);
+  void clear();
+
+  // Moves nodes from other before pos, without copying or allocating, so
+  // iterators and references to them stay valid. The whole-list and
+  // single-element forms are O(1); the range form has to count the range
+  // when other is a different list. Throws std::invalid_argument if other
+  // is a different list that doesn't share our pool and there is anything
+  // to move; neither list is changed then.
+  void splice(iterator pos, list& other);
+  void splice(iterator pos, list& other, iterator it);
+  void splice(iterator pos, list& other, iterator first, iterator last);
+
+  // The pool our nodes come from, for building lists that share it.
+  node_pool get_pool();
+
+  iterator begin();
+  iterator end();
+};
+
+}  // namespace tjs
+
+#include "list.tpp"
+#endif  // TJS_LIST_H
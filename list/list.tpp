@@ -0,0 +1,401 @@
+#include "list.h"
+
+namespace tjs {
+
+// ------------------------------------------------------------------------
+// Node and Pool
+// ------------------------------------------------------------------------
+
+template <class T>
+template <typename... Args>
+list<T>::node::node(std::in_place_t, Args&&... args)
+    : value(std::forward<Args>(args)...) {}
+
+template <class T>
+list<T>::pool::~pool() {
+  for (size_t i = 0; i < blocks.size(); i++) {
+    delete[] blocks[i];
+  }
+}
+
+// ------------------------------------------------------------------------
+// PRIVATE MEMBER FUNCTIONS
+// ------------------------------------------------------------------------
+
+template <class T>
+typename list<T>::slot* list<T>::allocate_slot() {
+  if (m_pool == nullptr) m_pool = new pool;
+  if (m_pool->free != nullptr) {
+    slot* s = m_pool->free;
+    m_pool->free = s->next_free;
+    return s;
+  }
+
+  if (m_pool->cursor == m_pool->limit) {
+    // Blocks double in size up to MAX_BLOCK slots.
+    size_t n = m_pool->next_block;
+    slot* block = new slot[n];
+    m_pool->blocks.push_back(block);
+    m_pool->cursor = block;
+    m_pool->limit = block + n;
+    if (n < pool::MAX_BLOCK) m_pool->next_block = n << 1;
+  }
+  return m_pool->cursor++;
+}
+
+template <class T>
+template <typename... Args>
+typename list<T>::node* list<T>::create_node(Args&&... args) {
+  slot* s = allocate_slot();
+  try {
+    return new (s->bytes) node(std::in_place, std::forward<Args>(args)...);
+  } catch (...) {
+    s->next_free = m_pool->free;
+    m_pool->free = s;
+    throw;
+  }
+}
+
+template <class T>
+void list<T>::destroy_node(node* n) {
+  n->~node();
+  slot* s = reinterpret_cast<slot*>(n);
+  s->next_free = m_pool->free;
+  m_pool->free = s;
+}
+
+template <class T>
+bool list<T>::shares_pool_with(const list& other) const {
+  return m_pool != nullptr && m_pool == other.m_pool;
+}
+
+template <class T>
+void list<T>::check_shared_pool(const list& other) const {
+  if (this != &other && !shares_pool_with(other))
+    throw std::invalid_argument(
+        "list::splice: lists don't share a node pool, construct them from "
+        "the same node_pool");
+}
+
+template <class T>
+void list<T>::release_pool() {
+  if (m_pool != nullptr && --m_pool->refs == 0) delete m_pool;
+  m_pool = nullptr;
+}
+
+// ------------------------------------------------------------------------
+// Node Pool
+// ------------------------------------------------------------------------
+
+template <class T>
+list<T>::node_pool::node_pool() : m_pool(new pool) {}
+
+template <class T>
+list<T>::node_pool::node_pool(pool* p) : m_pool(p) {
+  m_pool->refs++;
+}
+
+template <class T>
+list<T>::node_pool::node_pool(const node_pool& other) : m_pool(other.m_pool) {
+  m_pool->refs++;
+}
+
+template <class T>
+typename list<T>::node_pool& list<T>::node_pool::operator=(
+    const node_pool& other) {
+  other.m_pool->refs++;
+  if (--m_pool->refs == 0) delete m_pool;
+  m_pool = other.m_pool;
+  return *this;
+}
+
+template <class T>
+list<T>::node_pool::~node_pool() {
+  if (--m_pool->refs == 0) delete m_pool;
+}
+
+template <class T>
+size_t list<T>::node_pool::use_count() const {
+  return m_pool->refs;
+}
+
+template <class T>
+bool list<T>::node_pool::operator==(const node_pool& o) const {
+  return m_pool == o.m_pool;
+}
+
+template <class T>
+bool list<T>::node_pool::operator!=(const node_pool& o) const {
+  return m_pool != o.m_pool;
+}
+
+// ------------------------------------------------------------------------
+// Big 5
+// ------------------------------------------------------------------------
+
+template <class T>
+list<T>::list() {}
+
+template <class T>
+list<T>::list(const node_pool& shared) : m_pool(shared.m_pool) {
+  m_pool->refs++;
+}
+
+template <class T>
+list<T>::list(std::initializer_list<T> l) {
+  for (const auto& elem : l) {
+    push_back(elem);
+  }
+}
+
+template <class T>
+list<T>::list(const list& other) {
+  // There's no const_iterator yet, other is only read through this one.
+  list& src = const_cast<list&>(other);
+  for (auto it = src.begin(); it != src.end(); ++it) {
+    push_back(*it);
+  }
+}
+
+template <class T>
+list<T>::list(list&& other)
+    : m_nodes(std::move(other.m_nodes)),
+      m_size(other.m_size),
+      m_pool(other.m_pool) {
+  // Both lists hold the pool, so other can still splice with us cheaply.
+  if (m_pool != nullptr) m_pool->refs++;
+  other.m_size = 0;
+}
+
+template <class T>
+list<T>& list<T>::operator=(const list& other) {
+  if (this != &other) {
+    // Reuses our nodes through the free list.
+    clear();
+    list& src = const_cast<list&>(other);
+    for (auto it = src.begin(); it != src.end(); ++it) {
+      push_back(*it);
+    }
+  }
+  return *this;
+}
+
+template <class T>
+list<T>& list<T>::operator=(list&& other) {
+  if (this == &other) return *this;
+
+  clear();
+  if (m_pool == nullptr && other.m_pool != nullptr) {
+    m_pool = other.m_pool;
+    m_pool->refs++;
+  }
+  if (shares_pool_with(other)) {
+    m_nodes = std::move(other.m_nodes);
+    m_size = other.m_size;
+    other.m_size = 0;
+  } else {
+    // We keep our own pool, so the elements have to move over one by one.
+    for (auto it = other.begin(); it != other.end(); ++it) {
+      emplace_back(std::move(*it));
+    }
+    other.clear();
+  }
+  return *this;
+}
+
+template <class T>
+list<T>::~list() {
+  clear();
+  release_pool();
+}
+
+// ------------------------------------------------------------------------
+// Public Member Functions
+// ------------------------------------------------------------------------
+
+template <class T>
+size_t list<T>::size() const {
+  return m_size;
+}
+
+template <class T>
+bool list<T>::empty() const {
+  return m_size == 0;
+}
+
+template <class T>
+T& list<T>::front() {
+  return m_nodes.front().value;
+}
+
+template <class T>
+T& list<T>::back() {
+  return m_nodes.back().value;
+}
+
+template <class T>
+void list<T>::push_back(const T& elem) {
+  emplace_back(elem);
+}
+
+template <class T>
+void list<T>::push_front(const T& elem) {
+  emplace_front(elem);
+}
+
+template <class T>
+template <typename... Args>
+T& list<T>::emplace_back(Args&&... args) {
+  return *emplace(end(), std::forward<Args>(args)...);
+}
+
+template <class T>
+template <typename... Args>
+T& list<T>::emplace_front(Args&&... args) {
+  return *emplace(begin(), std::forward<Args>(args)...);
+}
+
+template <class T>
+typename list<T>::iterator list<T>::insert(iterator pos, const T& elem) {
+  return emplace(pos, elem);
+}
+
+template <class T>
+template <typename... Args>
+typename list<T>::iterator list<T>::emplace(iterator pos, Args&&... args) {
+  node* n = create_node(std::forward<Args>(args)...);
+  m_size++;
+  return iterator(m_nodes.insert(pos.it_, *n));
+}
+
+template <class T>
+void list<T>::pop_back() {
+  erase(--end());
+}
+
+template <class T>
+void list<T>::pop_front() {
+  erase(begin());
+}
+
+template <class T>
+typename list<T>::iterator list<T>::erase(iterator pos) {
+  node* n = &*pos.it_;
+  iterator next(m_nodes.erase(pos.it_));
+  destroy_node(n);
+  m_size--;
+  return next;
+}
+
+template <class T>
+void list<T>::clear() {
+  while (!m_nodes.empty()) {
+    node* n = &m_nodes.front();
+    m_nodes.pop_front();
+    destroy_node(n);
+  }
+  m_size = 0;
+}
+
+template <class T>
+void list<T>::splice(iterator pos, list& other) {
+  if (this == &other || other.empty()) return;
+  check_shared_pool(other);
+  m_nodes.splice(pos.it_, other.m_nodes);
+  m_size += other.m_size;
+  other.m_size = 0;
+}
+
+template <class T>
+void list<T>::splice(iterator pos, list& other, iterator it) {
+  if (this != &other) {
+    check_shared_pool(other);
+    m_size++;
+    other.m_size--;
+  }
+  m_nodes.splice(pos.it_, other.m_nodes, it.it_);
+}
+
+template <class T>
+void list<T>::splice(iterator pos, list& other, iterator first,
+                     iterator last) {
+  if (this != &other && first != last) {
+    check_shared_pool(other);
+    size_t n = std::distance(first, last);
+    m_size += n;
+    other.m_size -= n;
+  }
+  m_nodes.splice(pos.it_, other.m_nodes, first.it_, last.it_);
+}
+
+template <class T>
+typename list<T>::node_pool list<T>::get_pool() {
+  if (m_pool == nullptr) m_pool = new pool;
+  return node_pool(m_pool);
+}
+
+template <class T>
+typename list<T>::iterator list<T>::begin() {
+  return iterator(m_nodes.begin());
+}
+
+template <class T>
+typename list<T>::iterator list<T>::end() {
+  return iterator(m_nodes.end());
+}
+
+// ------------------------------------------------------------------------
+// Iterator Implementations
+// ------------------------------------------------------------------------
+
+template <class T>
+list<T>::iterator::iterator(typename intrusive_list<node>::iterator it)
+    : it_(it) {}
+
+template <class T>
+typename list<T>::iterator::reference list<T>::iterator::operator*() const {
+  return it_->value;
+}
+
+template <class T>
+typename list<T>::iterator::pointer list<T>::iterator::operator->() const {
+  return &it_->value;
+}
+
+template <class T>
+typename list<T>::iterator& list<T>::iterator::operator++() {
+  ++it_;
+  return *this;
+}
+
+template <class T>
+typename list<T>::iterator list<T>::iterator::operator++(int) {
+  iterator tmp(*this);
+  ++it_;
+  return tmp;
+}
+
+template <class T>
+typename list<T>::iterator& list<T>::iterator::operator--() {
+  --it_;
+  return *this;
+}
+
+template <class T>
+typename list<T>::iterator list<T>::iterator::operator--(int) {
+  iterator tmp(*this);
+  --it_;
+  return tmp;
+}
+
+template <class T>
+bool list<T>::iterator::operator==(const iterator& o) const {
+  return it_ == o.it_;
+}
+
+template <class T>
+bool list<T>::iterator::operator!=(const iterator& o) const {
+  return it_ != o.it_;
+}
+
+}  // namespace tjs
@@ -0,0 +1,149 @@
+#ifndef TJS_SERIALIZE_H
+#define TJS_SERIALIZE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include "string/string.h"
+#include "vector/vector.h"
+
+namespace tjs {
+
+// ------------------------------------------------------------------------
+// Binary Format
+// ------------------------------------------------------------------------
+// Every serialized object is a blob: a fixed 24 byte header followed by its
+// payload, zero padded to a multiple of 8 bytes so that blobs can be written
+// back to back and every payload stays 8 byte aligned.
+//
+//   pod vector:    count * elem_size bytes of raw elements.
+//   string:        count bytes of characters (no null terminator).
+//   string vector: (count + 1) uint64 offsets, then all characters
+//                  concatenated; string i spans [offsets[i], offsets[i + 1]).
+struct blob_header {
+  static constexpr char MAGIC[4] = {'T', 'J', 'S', 'B'};
+  static constexpr uint16_t VERSION = 1;
+  static constexpr uint32_t ENDIAN_MARK = 0x01020304;  // Detects endianness.
+
+  enum kind : uint16_t {
+    POD_VECTOR = 1,
+    STRING = 2,
+    STRING_VECTOR = 3,
+  };
+
+  char magic[4];
+  uint16_t version;
+  uint16_t kind;
+  uint32_t elem_size;
+  uint32_t endian_mark;
+  uint64_t count;
+};
+
+static_assert(sizeof(blob_header) == 24, "blob_header must stay 24 bytes");
+
+// ------------------------------------------------------------------------
+// Views
+// ------------------------------------------------------------------------
+// Read-only views straight over a serialized buffer. They never own memory,
+// so the buffer (or mmap) must outlive them.
+template <class T>
+class vector_view {
+  const T* m_data = nullptr;
+  size_t m_size = 0;
+
+ public:
+  vector_view() = default;
+  vector_view(const T* data, size_t size);
+
+  size_t size() const;
+  bool empty() const;
+  const T* data() const;
+  const T& operator[](size_t i) const;
+
+  const T* begin() const;
+  const T* end() const;
+};
+
+class string_vector_view {
+  const uint64_t* m_offsets = nullptr;  // m_size + 1 entries.
+  const char* m_chars = nullptr;
+  size_t m_size = 0;
+  size_t m_chars_size = 0;
+
+ public:
+  string_vector_view() = default;
+  string_vector_view(const uint64_t* offsets, const char* chars, size_t size,
+                     size_t chars_size);
+
+  size_t size() const;
+  bool empty() const;
+  std::string_view operator[](size_t i) const;
+};
+
+// ------------------------------------------------------------------------
+// Writer
+// ------------------------------------------------------------------------
+class binary_writer {
+  std::ostream& m_os;
+  size_t m_written = 0;
+
+  void write_header(uint16_t kind, uint32_t elem_size, uint64_t count);
+  void write_bytes(const void* p, size_t n);
+  void write_padding();
+
+ public:
+  explicit binary_writer(std::ostream& os);
+
+  template <class T>
+  void write(const vector<T>& vec);
+  void write(const string& s);
+  void write(const vector<string>& vec);
+
+  size_t bytes_written() const;
+};
+
+// ------------------------------------------------------------------------
+// Reader
+// ------------------------------------------------------------------------
+// Reads blobs in the order they were written from a memory buffer. The
+// buffer must be 8 byte aligned (anything from new, malloc or mmap is).
+// read_* functions copy into owning containers, view_* functions return
+// views over the buffer without copying. Malformed input throws
+// std::runtime_error.
+class binary_reader {
+  const char* m_data;
+  size_t m_size;
+  size_t m_pos = 0;
+
+  blob_header next_header(uint16_t kind, uint32_t elem_size);
+  const char* take(size_t n);
+  void skip_padding();
+
+  template <class T>
+  const T* take_array(size_t count);
+
+ public:
+  binary_reader(const void* data, size_t size);
+
+  template <class T>
+  vector<T> read_vector();
+  string read_string();
+  vector<string> read_string_vector();
+
+  template <class T>
+  vector_view<T> view_vector();
+  std::string_view view_string();
+  string_vector_view view_string_vector();
+
+  size_t position() const;
+  bool at_end() const;
+};
+
+}  // namespace tjs
+
+#include "serialize.tpp"
+#endif  // TJS_SERIALIZE_H
@@ -0,0 +1,253 @@
+#include <cstring>
+
+#include "serialize.h"
+
+namespace tjs {
+
+// ------------------------------------------------------------------------
+// View Implementations
+// ------------------------------------------------------------------------
+
+template <class T>
+vector_view<T>::vector_view(const T* data, size_t size)
+    : m_data(data), m_size(size) {}
+
+template <class T>
+size_t vector_view<T>::size() const {
+  return m_size;
+}
+
+template <class T>
+bool vector_view<T>::empty() const {
+  return m_size == 0;
+}
+
+template <class T>
+const T* vector_view<T>::data() const {
+  return m_data;
+}
+
+template <class T>
+const T& vector_view<T>::operator[](size_t i) const {
+  if (i >= m_size)
+    throw std::out_of_range("Element " + std::to_string(i) +
+                            " is out of range, view has " +
+                            std::to_string(m_size) + " elements.");
+  return m_data[i];
+}
+
+template <class T>
+const T* vector_view<T>::begin() const {
+  return m_data;
+}
+
+template <class T>
+const T* vector_view<T>::end() const {
+  return m_data + m_size;
+}
+
+inline string_vector_view::string_vector_view(const uint64_t* offsets,
+                                              const char* chars, size_t size,
+                                              size_t chars_size)
+    : m_offsets(offsets),
+      m_chars(chars),
+      m_size(size),
+      m_chars_size(chars_size) {}
+
+inline size_t string_vector_view::size() const { return m_size; }
+
+inline bool string_vector_view::empty() const { return m_size == 0; }
+
+inline std::string_view string_vector_view::operator[](size_t i) const {
+  if (i >= m_size)
+    throw std::out_of_range("Element " + std::to_string(i) +
+                            " is out of range, view has " +
+                            std::to_string(m_size) + " elements.");
+  // Offsets are checked on access rather than on load, so opening a view
+  // stays O(1) regardless of how many strings it holds.
+  uint64_t first = m_offsets[i];
+  uint64_t last = m_offsets[i + 1];
+  if (first > last || last > m_chars_size)
+    throw std::runtime_error("Corrupt string offset table");
+  return std::string_view(m_chars + first, last - first);
+}
+
+// ------------------------------------------------------------------------
+// Writer Implementations
+// ------------------------------------------------------------------------
+
+inline binary_writer::binary_writer(std::ostream& os) : m_os(os) {}
+
+inline void binary_writer::write_header(uint16_t kind, uint32_t elem_size,
+                                        uint64_t count) {
+  blob_header h;
+  std::memcpy(h.magic, blob_header::MAGIC, sizeof(h.magic));
+  h.version = blob_header::VERSION;
+  h.kind = kind;
+  h.elem_size = elem_size;
+  h.endian_mark = blob_header::ENDIAN_MARK;
+  h.count = count;
+  write_bytes(&h, sizeof(h));
+}
+
+inline void binary_writer::write_bytes(const void* p, size_t n) {
+  if (n == 0) return;
+  m_os.write(static_cast<const char*>(p), static_cast<std::streamsize>(n));
+  if (!m_os) throw std::runtime_error("Writing to output stream failed");
+  m_written += n;
+}
+
+inline void binary_writer::write_padding() {
+  static constexpr char zeros[8] = {};
+  write_bytes(zeros, (8 - m_written % 8) % 8);
+}
+
+template <class T>
+void binary_writer::write(const vector<T>& vec) {
+  static_assert(std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>,
+                "Only vectors of trivially copyable types can be written "
+                "as raw bytes (vector<bool> is bit packed)");
+  write_header(blob_header::POD_VECTOR, sizeof(T), vec.size());
+  write_bytes(vec.data(), vec.size() * sizeof(T));
+  write_padding();
+}
+
+inline void binary_writer::write(const string& s) {
+  write_header(blob_header::STRING, 1, s.size());
+  write_bytes(s.data(), s.size());
+  write_padding();
+}
+
+inline void binary_writer::write(const vector<string>& vec) {
+  size_t n = vec.size();
+  write_header(blob_header::STRING_VECTOR, 1, n);
+
+  // Build the whole offset table first so it goes out in one write.
+  vector<uint64_t> offsets(n + 1);
+  uint64_t* off = offsets.data();
+  off[0] = 0;
+  for (size_t i = 0; i < n; i++) {
+    off[i + 1] = off[i] + vec[i].size();
+  }
+  write_bytes(off, (n + 1) * sizeof(uint64_t));
+  for (size_t i = 0; i < n; i++) {
+    write_bytes(vec[i].data(), vec[i].size());
+  }
+  write_padding();
+}
+
+inline size_t binary_writer::bytes_written() const { return m_written; }
+
+// ------------------------------------------------------------------------
+// Reader Implementations
+// ------------------------------------------------------------------------
+
+inline binary_reader::binary_reader(const void* data, size_t size)
+    : m_data(static_cast<const char*>(data)), m_size(size) {}
+
+inline const char* binary_reader::take(size_t n) {
+  if (n > m_size - m_pos)
+    throw std::runtime_error("Unexpected end of buffer: need " +
+                             std::to_string(n) + " bytes, " +
+                             std::to_string(m_size - m_pos) + " left.");
+  const char* p = m_data + m_pos;
+  m_pos += n;
+  return p;
+}
+
+inline void binary_reader::skip_padding() {
+  size_t pad = (8 - m_pos % 8) % 8;
+  // The final blob of a truncated buffer may be missing its padding.
+  m_pos += std::min(pad, m_size - m_pos);
+}
+
+inline blob_header binary_reader::next_header(uint16_t kind,
+                                              uint32_t elem_size) {
+  blob_header h;
+  std::memcpy(&h, take(sizeof(h)), sizeof(h));
+  if (std::memcmp(h.magic, blob_header::MAGIC, sizeof(h.magic)) != 0)
+    throw std::runtime_error("Bad magic, not a tjs binary blob");
+  if (h.endian_mark != blob_header::ENDIAN_MARK)
+    throw std::runtime_error("Blob was written with a different byte order");
+  if (h.version != blob_header::VERSION)
+    throw std::runtime_error("Unsupported blob version " +
+                             std::to_string(h.version));
+  if (h.kind != kind)
+    throw std::runtime_error("Expected blob kind " + std::to_string(kind) +
+                             ", found " + std::to_string(h.kind));
+  if (h.elem_size != elem_size)
+    throw std::runtime_error("Expected element size " +
+                             std::to_string(elem_size) + ", found " +
+                             std::to_string(h.elem_size));
+  return h;
+}
+
+template <class T>
+const T* binary_reader::take_array(size_t count) {
+  if (count > (m_size - m_pos) / sizeof(T))
+    throw std::runtime_error("Unexpected end of buffer: array of " +
+                             std::to_string(count) + " elements is truncated");
+  const char* p = take(count * sizeof(T));
+  if (reinterpret_cast<uintptr_t>(p) % alignof(T) != 0)
+    throw std::runtime_error("Buffer is not aligned for the element type");
+  return reinterpret_cast<const T*>(p);
+}
+
+template <class T>
+vector<T> binary_reader::read_vector() {
+  vector_view<T> view = view_vector<T>();
+  return vector<T>(view.begin(), view.end());
+}
+
+inline string binary_reader::read_string() {
+  std::string_view view = view_string();
+  return string(view.data(), view.size());
+}
+
+inline vector<string> binary_reader::read_string_vector() {
+  string_vector_view view = view_string_vector();
+  vector<string> out;
+  out.reserve(view.size());
+  for (size_t i = 0; i < view.size(); i++) {
+    std::string_view s = view[i];
+    out.emplace_back(s.data(), s.size());
+  }
+  return out;
+}
+
+template <class T>
+vector_view<T> binary_reader::view_vector() {
+  static_assert(std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>,
+                "Only vectors of trivially copyable types can be read "
+                "as raw bytes (vector<bool> is bit packed)");
+  blob_header h = next_header(blob_header::POD_VECTOR, sizeof(T));
+  const T* p = take_array<T>(h.count);
+  skip_padding();
+  return vector_view<T>(p, h.count);
+}
+
+inline std::string_view binary_reader::view_string() {
+  blob_header h = next_header(blob_header::STRING, 1);
+  const char* p = take_array<char>(h.count);
+  skip_padding();
+  return std::string_view(p, h.count);
+}
+
+inline string_vector_view binary_reader::view_string_vector() {
+  blob_header h = next_header(blob_header::STRING_VECTOR, 1);
+  if (h.count >= (m_size - m_pos) / sizeof(uint64_t))
+    throw std::runtime_error("Unexpected end of buffer: offset table of " +
+                             std::to_string(h.count) +
+                             " strings is truncated");
+  const uint64_t* offsets = take_array<uint64_t>(h.count + 1);
+  uint64_t chars_size = offsets[h.count];
+  const char* chars = take_array<char>(chars_size);
+  skip_padding();
+  return string_vector_view(offsets, chars, h.count, chars_size);
+}
+
+inline size_t binary_reader::position() const { return m_pos; }
+
+inline bool binary_reader::at_end() const { return m_pos == m_size; }
+
+}  // namespace tjs
@@ -2,10 +2,13 @@
 #define TJS_STRING_H
 
 #include <algorithm>
+#include <charconv>
 #include <cstddef>
 #include <initializer_list>
 #include <limits>
 #include <stdexcept>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace tjs {
@@ -32,6 +35,19 @@ class string {
   bool is_sso();
   void allocate_heap(size_t count);
   void allocate_and_copy(const char* s, size_t count);
+  void ensure_spare(size_t n);
+
+  template <class T>
+  static constexpr size_t max_chars();
+  template <class T>
+  static size_t estimate_chars(const T& arg);
+  template <class T>
+  void append_arg(const T& arg);
+  const char* append_literal(const char* fmt);
+  void append_format_impl(const char* fmt);
+  template <class T, class... Rest>
+  void append_format_impl(const char* fmt, const T& first,
+                          const Rest&... rest);
 
   // ------------------------------------------------------------------------
   // Big 5
@@ -50,15 +66,16 @@ class string {
   // ------------------------------------------------------------------------
   // Public Member Functions
   // ------------------------------------------------------------------------
-  size_t size();
-  size_t capacity();
-  bool empty();
+  size_t size() const;
+  size_t capacity() const;
+  bool empty() const;
   void reserve(size_t new_cap);
 
   char& operator[](size_t pos);
   char& front();
   char& back();
-  const char* c_str();
+  const char* c_str() const;
+  const char* data() const;
 
   void clear();
   void push_back(char c);
@@ -71,6 +88,27 @@ class string {
 
   string substr(size_t pos, size_t len = npos) const;
 
+  int compare(const string& other) const;
+  bool operator==(const string& other) const;
+  bool operator!=(const string& other) const;
+  bool operator<(const string& other) const;
+
+  // Numbers are formatted straight into spare capacity, with no temporary
+  // buffer. Floating point values use the shortest round-trip form.
+  template <class T>
+  string& append_number(T value);
+
+  // Appends fmt with each "{}" replaced by the next argument ("{{" and "}}"
+  // are literal braces). Arguments may be numbers, chars, C strings,
+  // std::string_view or tjs::string. Reserves once for the whole line.
+  template <class... Args>
+  string& append_format(const char* fmt, const Args&... args);
+
+  // Parses a number starting at pos (from_chars rules: no leading
+  // whitespace or '+'). Returns how many characters were consumed.
+  template <class T>
+  size_t parse_number(T& value, size_t pos = 0) const;
+
   // ------------------------------------------------------------------------
   // Iterator
   // ------------------------------------------------------------------------
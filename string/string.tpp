@@ -8,14 +8,14 @@ namespace tjs {
 // ------------------------------------------------------------------------
 // PRIVATE MEMBER FUNCTIONS
 // ------------------------------------------------------------------------
-bool string::is_sso() { return m_data == m_sso_buffer; }
+inline bool string::is_sso() { return m_data == m_sso_buffer; }
 
-void string::allocate_heap(size_t count) {
+inline void string::allocate_heap(size_t count) {
   m_capacity = count;
   m_data = new char[count + 1];
 }
 
-void string::allocate_and_copy(const char* s, size_t count) {
+inline void string::allocate_and_copy(const char* s, size_t count) {
   if (count <= SSO_BUFFER_SIZE - 1) {
     m_data = m_sso_buffer;  // Use the SSO buffer.
     m_capacity = SSO_BUFFER_SIZE - 1;
@@ -26,20 +26,102 @@ void string::allocate_and_copy(const char* s, size_t count) {
   m_data[count] = '\0';  // Add the null terminator.
 }
 
+inline void string::ensure_spare(size_t n) {
+  if (m_size + n > m_capacity) {
+    reserve(std::max(m_size + n, 2 * m_capacity));
+  }
+}
+
+// Upper bound on the characters to_chars can produce for a T.
+template <class T>
+constexpr size_t string::max_chars() {
+  if constexpr (std::is_integral_v<T>) {
+    // Digits plus a sign.
+    return std::numeric_limits<T>::digits10 + 2;
+  } else {
+    // Sign, digits, '.', 'e', exponent sign and up to 5 exponent digits.
+    return std::numeric_limits<T>::max_digits10 + 9;
+  }
+}
+
+template <class T>
+size_t string::estimate_chars(const T& arg) {
+  if constexpr (std::is_same_v<T, char>) {
+    return 1;
+  } else if constexpr (std::is_same_v<T, bool>) {
+    return 5;
+  } else if constexpr (std::is_arithmetic_v<T>) {
+    return max_chars<T>();
+  } else if constexpr (std::is_same_v<T, string>) {
+    return arg.size();
+  } else {
+    return std::string_view(arg).size();
+  }
+}
+
+template <class T>
+void string::append_arg(const T& arg) {
+  if constexpr (std::is_same_v<T, char>) {
+    push_back(arg);
+  } else if constexpr (std::is_same_v<T, bool>) {
+    append(arg ? "true" : "false");
+  } else if constexpr (std::is_arithmetic_v<T>) {
+    append_number(arg);
+  } else if constexpr (std::is_same_v<T, string>) {
+    append(arg);
+  } else {
+    std::string_view sv(arg);
+    append(sv.data(), sv.size());
+  }
+}
+
+// Appends fmt up to the next "{}" placeholder, unescaping "{{" and "}}".
+// Returns a pointer to the placeholder, or to the null terminator.
+inline const char* string::append_literal(const char* fmt) {
+  const char* p = fmt;
+  while (true) {
+    const char* start = p;
+    while (*p != '\0' && *p != '{' && *p != '}') ++p;
+    append(start, p - start);
+    if (*p == '\0') return p;
+    if (p[0] == '{' && p[1] == '}') return p;
+    if (p[0] != p[1])
+      throw std::invalid_argument("string::append_format: unmatched brace");
+    push_back(*p);  // Escaped brace.
+    p += 2;
+  }
+}
+
+inline void string::append_format_impl(const char* fmt) {
+  if (*append_literal(fmt) != '\0')
+    throw std::invalid_argument(
+        "string::append_format: not enough arguments");
+}
+
+template <class T, class... Rest>
+void string::append_format_impl(const char* fmt, const T& first,
+                                const Rest&... rest) {
+  const char* p = append_literal(fmt);
+  if (*p == '\0')
+    throw std::invalid_argument("string::append_format: too many arguments");
+  append_arg(first);
+  append_format_impl(p + 2, rest...);
+}
+
 // ------------------------------------------------------------------------
 // Big 5
 // ------------------------------------------------------------------------
-string::string() : m_size(0) {
+inline string::string() : m_size(0) {
   m_data = m_sso_buffer;
   m_capacity = SSO_BUFFER_SIZE - 1;
   m_sso_buffer[0] = '\0';
 }
 
-string::string(const string& other) : m_size(other.m_size) {
+inline string::string(const string& other) : m_size(other.m_size) {
   allocate_and_copy(other.m_data, m_size);
 }
 
-string::string(string&& other) : m_size(other.m_size) {
+inline string::string(string&& other) : m_size(other.m_size) {
   if (other.is_sso()) {
     m_data = m_sso_buffer;
     m_capacity = SSO_BUFFER_SIZE - 1;
@@ -54,7 +136,7 @@ string::string(string&& other) : m_size(other.m_size) {
   std::memset(other.m_sso_buffer, 0, other.SSO_BUFFER_SIZE);
 }
 
-string::string(const string& other, size_t pos, size_t len) : m_size(0) {
+inline string::string(const string& other, size_t pos, size_t len) : m_size(0) {
   if (pos < other.m_size) {
     size_t rlen =
         (len == npos ? other.m_size - pos : std::min(len, other.m_size - pos));
@@ -67,13 +149,15 @@ string::string(const string& other, size_t pos, size_t len) : m_size(0) {
   }
 }
 
-string::string(const char* s) : m_size(std::strlen(s)) {
+inline string::string(const char* s) : m_size(std::strlen(s)) {
   allocate_and_copy(s, m_size);
 }
 
-string::string(const char* s, size_t n) : m_size(n) { allocate_and_copy(s, n); }
+inline string::string(const char* s, size_t n) : m_size(n) {
+  allocate_and_copy(s, n);
+}
 
-string::string(size_t n, char c) : m_size(n) {
+inline string::string(size_t n, char c) : m_size(n) {
   if (n <= SSO_BUFFER_SIZE - 1) {
     m_data = m_sso_buffer;
     m_capacity = SSO_BUFFER_SIZE - 1;
@@ -84,22 +168,22 @@ string::string(size_t n, char c) : m_size(n) {
   m_data[n] = '\0';
 }
 
-string::~string() {
+inline string::~string() {
   if (!is_sso()) delete[] m_data;
 }
 
-string& string::operator=(const string& other) {
+inline string& string::operator=(const string& other) {
   if (this != &other) {
-    if (!is_sso()) ::operator delete(m_data);
+    if (!is_sso()) delete[] m_data;
     m_size = other.m_size;
     allocate_and_copy(other.m_data, m_size);
   }
   return *this;
 }
 
-string& string::operator=(string&& other) {
+inline string& string::operator=(string&& other) {
   if (this != &other) {
-    if (!is_sso()) ::operator delete(m_data);
+    if (!is_sso()) delete[] m_data;
     if (other.is_sso()) {
       m_data = m_sso_buffer;
       m_capacity = SSO_BUFFER_SIZE - 1;
@@ -120,11 +204,11 @@ string& string::operator=(string&& other) {
 // ------------------------------------------------------------------------
 // Other Member Functions
 // ------------------------------------------------------------------------
-size_t string::size() { return m_size; }
-size_t string::capacity() { return m_capacity; }
-bool string::empty() { return m_size == 0; }
+inline size_t string::size() const { return m_size; }
+inline size_t string::capacity() const { return m_capacity; }
+inline bool string::empty() const { return m_size == 0; }
 
-void string::reserve(size_t new_cap) {
+inline void string::reserve(size_t new_cap) {
   if (new_cap <= m_capacity) return;
   char* old_data = m_data;
   size_t old_size = m_size;
@@ -136,20 +220,21 @@ void string::reserve(size_t new_cap) {
 }
 
 // ———— ELEMENT ACCESS ————
-char& string::operator[](size_t pos) {
+inline char& string::operator[](size_t pos) {
   if (pos >= m_size) throw std::out_of_range("string::at");
   return m_data[pos];
 }
-char& string::front() { return m_data[0]; }
-char& string::back() { return m_data[m_size - 1]; }
-const char* string::c_str() { return m_data; }
+inline char& string::front() { return m_data[0]; }
+inline char& string::back() { return m_data[m_size - 1]; }
+inline const char* string::c_str() const { return m_data; }
+inline const char* string::data() const { return m_data; }
 
-void string::clear() {
+inline void string::clear() {
   m_size = 0;
   m_data[0] = '\0';
 }
 
-void string::push_back(char c) {
+inline void string::push_back(char c) {
   if (m_size + 1 > m_capacity) {
     reserve(std::max<size_t>(2 * m_capacity, 1));
   }
@@ -157,124 +242,186 @@ void string::push_back(char c) {
   m_data[m_size] = '\0';
 }
 
-void string::pop_back() {
+inline void string::pop_back() {
   if (m_size > 0) {
     m_data[--m_size] = '\0';
   }
 }
 
-string& string::append(const char* s, size_t n) {
-  if (m_size + n > m_capacity) {
-    reserve(std::max(m_size + n, 2 * m_capacity));
-  }
+inline string& string::append(const char* s, size_t n) {
+  ensure_spare(n);
   std::memcpy(m_data + m_size, s, n);
   m_size += n;
   m_data[m_size] = '\0';
   return *this;
 }
 
-string& string::append(const string& s) { return append(s.m_data, s.m_size); }
+inline string& string::append(const string& s) {
+  return append(s.m_data, s.m_size);
+}
 
-string& string::append(const char* s) { return append(s, std::strlen(s)); }
+inline string& string::append(const char* s) {
+  return append(s, std::strlen(s));
+}
 
-string& string::operator+=(char c) {
+inline string& string::operator+=(char c) {
   push_back(c);
   return *this;
 }
-string& string::operator+=(const string& s) { return append(s); }
+inline string& string::operator+=(const string& s) { return append(s); }
 
-string string::substr(size_t pos, size_t len) const {
+inline string string::substr(size_t pos, size_t len) const {
   return string(*this, pos, len);
 }
 
+// ———— COMPARISON ————
+// Lexicographic by unsigned char, like std::string.
+inline int string::compare(const string& other) const {
+  int c = std::memcmp(m_data, other.m_data, std::min(m_size, other.m_size));
+  if (c != 0) return c;
+  if (m_size == other.m_size) return 0;
+  return m_size < other.m_size ? -1 : 1;
+}
+
+inline bool string::operator==(const string& other) const {
+  return m_size == other.m_size &&
+         std::memcmp(m_data, other.m_data, m_size) == 0;
+}
+
+inline bool string::operator!=(const string& other) const {
+  return !(*this == other);
+}
+
+inline bool string::operator<(const string& other) const {
+  return compare(other) < 0;
+}
+
+// ———— NUMERIC CONVERSIONS ————
+template <class T>
+string& string::append_number(T value) {
+  static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                "append_number requires an integer or floating point type");
+  ensure_spare(max_chars<T>());
+  std::to_chars_result res =
+      std::to_chars(m_data + m_size, m_data + m_capacity, value);
+  if (res.ec != std::errc())
+    throw std::runtime_error("string::append_number: formatting failed");
+  m_size = res.ptr - m_data;
+  m_data[m_size] = '\0';
+  return *this;
+}
+
+template <class... Args>
+string& string::append_format(const char* fmt, const Args&... args) {
+  ensure_spare(std::strlen(fmt) + (estimate_chars(args) + ... + 0));
+  append_format_impl(fmt, args...);
+  return *this;
+}
+
+template <class T>
+size_t string::parse_number(T& value, size_t pos) const {
+  static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                "parse_number requires an integer or floating point type");
+  if (pos > m_size) throw std::out_of_range("string::parse_number");
+  const char* first = m_data + pos;
+  std::from_chars_result res = std::from_chars(first, m_data + m_size, value);
+  if (res.ec == std::errc::invalid_argument)
+    throw std::invalid_argument("string::parse_number: no number found");
+  if (res.ec == std::errc::result_out_of_range)
+    throw std::out_of_range("string::parse_number: value out of range");
+  return res.ptr - first;
+}
+
 // ------------------------------------------------------------------------
 // Iterator Implementations
 // ------------------------------------------------------------------------
 
-string::iterator::iterator(char* ptr) : ptr_(ptr) {}
+inline string::iterator::iterator(char* ptr) : ptr_(ptr) {}
 
-string::iterator::reference string::iterator::operator*() const {
+inline string::iterator::reference string::iterator::operator*() const {
   return *ptr_;
 }
 
-string::iterator::pointer string::iterator::operator->() const { return ptr_; }
+inline string::iterator::pointer string::iterator::operator->() const {
+  return ptr_;
+}
 
-string::iterator& string::iterator::operator++() {
+inline string::iterator& string::iterator::operator++() {
   ++ptr_;
   return *this;
 }
 
-string::iterator string::iterator::operator++(int) {
+inline string::iterator string::iterator::operator++(int) {
   iterator tmp(*this);
   ++ptr_;
   return tmp;
 }
 
-string::iterator& string::iterator::operator--() {
+inline string::iterator& string::iterator::operator--() {
   --ptr_;
   return *this;
 }
 
-string::iterator string::iterator::operator--(int) {
+inline string::iterator string::iterator::operator--(int) {
   iterator tmp(*this);
   --ptr_;
   return tmp;
 }
 
-string::iterator string::iterator::operator+(difference_type n) const {
+inline string::iterator string::iterator::operator+(difference_type n) const {
   return iterator(ptr_ + n);
 }
 
-string::iterator string::iterator::operator-(difference_type n) const {
+inline string::iterator string::iterator::operator-(difference_type n) const {
   return iterator(ptr_ - n);
 }
 
-string::iterator::difference_type string::iterator::operator-(
+inline string::iterator::difference_type string::iterator::operator-(
     const iterator& o) const {
   return ptr_ - o.ptr_;
 }
 
-string::iterator& string::iterator::operator+=(difference_type n) {
+inline string::iterator& string::iterator::operator+=(difference_type n) {
   ptr_ += n;
   return *this;
 }
 
-string::iterator& string::iterator::operator-=(difference_type n) {
+inline string::iterator& string::iterator::operator-=(difference_type n) {
   ptr_ -= n;
   return *this;
 }
 
-string::iterator::reference string::iterator::operator[](
+inline string::iterator::reference string::iterator::operator[](
     difference_type n) const {
   return *(ptr_ + n);
 }
 
-bool string::iterator::operator==(const iterator& o) const {
+inline bool string::iterator::operator==(const iterator& o) const {
   return ptr_ == o.ptr_;
 }
 
-bool string::iterator::operator!=(const iterator& o) const {
+inline bool string::iterator::operator!=(const iterator& o) const {
   return ptr_ != o.ptr_;
 }
 
-bool string::iterator::operator<(const iterator& o) const {
+inline bool string::iterator::operator<(const iterator& o) const {
   return ptr_ < o.ptr_;
 }
 
-bool string::iterator::operator>(const iterator& o) const {
+inline bool string::iterator::operator>(const iterator& o) const {
   return ptr_ > o.ptr_;
 }
 
-bool string::iterator::operator<=(const iterator& o) const {
+inline bool string::iterator::operator<=(const iterator& o) const {
   return ptr_ <= o.ptr_;
 }
 
-bool string::iterator::operator>=(const iterator& o) const {
+inline bool string::iterator::operator>=(const iterator& o) const {
   return ptr_ >= o.ptr_;
 }
 
-string::iterator string::begin() { return iterator(m_data); }
+inline string::iterator string::begin() { return iterator(m_data); }
 
-string::iterator string::end() { return iterator(m_data + m_size); }
+inline string::iterator string::end() { return iterator(m_data + m_size); }
 
 }  // namespace tjs
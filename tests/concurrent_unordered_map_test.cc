@@ -0,0 +1,114 @@
+#include "concurrent_unordered_map/concurrent_unordered_map.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <utility>
+
+using tjs::concurrent_unordered_map;
+
+TEST(ConcurrentMapTest, InsertFindErase) {
+  concurrent_unordered_map<int, std::string> m(4, 2);
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.insert(1, "one"));
+  EXPECT_FALSE(m.insert(1, "uno"));
+  EXPECT_EQ(*m.find(1), "one");
+
+  EXPECT_FALSE(m.insert_or_assign(1, "uno"));
+  EXPECT_EQ(*m.find(1), "uno");
+  EXPECT_TRUE(m.insert_or_assign(2, "two"));
+  EXPECT_EQ(m.size(), 2u);
+
+  EXPECT_TRUE(m.erase(1));
+  EXPECT_FALSE(m.erase(1));
+  EXPECT_FALSE(m.find(1).has_value());
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_TRUE(m.contains(2));
+  EXPECT_EQ(m.size(), 1u);
+
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_FALSE(m.contains(2));
+}
+
+TEST(ConcurrentMapTest, ShardCountRoundsUpToPowerOfTwo) {
+  concurrent_unordered_map<int, int> m(5);
+  EXPECT_EQ(m.shard_count(), 8u);
+  concurrent_unordered_map<int, int> one(0);
+  EXPECT_EQ(one.shard_count(), 1u);
+}
+
+TEST(ConcurrentMapTest, GrowthAndTombstoneReuse) {
+  concurrent_unordered_map<int, int> m(2, 2);
+  for (int i = 0; i < 10000; i++) EXPECT_TRUE(m.insert(i, i * 2));
+  EXPECT_EQ(m.size(), 10000u);
+  for (int i = 0; i < 10000; i++) EXPECT_EQ(*m.find(i), i * 2);
+
+  // Churn through erase/insert, tombstones must not fill the tables.
+  for (int round = 0; round < 5; round++) {
+    for (int i = 0; i < 10000; i += 2) EXPECT_TRUE(m.erase(i));
+    for (int i = 0; i < 10000; i += 2) EXPECT_TRUE(m.insert(i, -i));
+  }
+  EXPECT_EQ(m.size(), 10000u);
+  EXPECT_EQ(*m.find(4), -4);
+  EXPECT_EQ(*m.find(5), 10);
+}
+
+TEST(ConcurrentMapTest, BatchInsertOrAssign) {
+  concurrent_unordered_map<int, int> m(8, 2);
+  m.insert(3, 0);
+
+  tjs::vector<std::pair<int, int>> batch;
+  for (int i = 0; i < 1000; i++) batch.push_back({i, i + 1});
+  m.insert_or_assign(batch);
+
+  EXPECT_EQ(m.size(), 1000u);
+  for (int i = 0; i < 1000; i++) EXPECT_EQ(*m.find(i), i + 1);
+}
+
+TEST(ConcurrentMapTest, VisitRunsUnderLock) {
+  concurrent_unordered_map<int, std::string> m;
+  m.insert(7, "seven");
+  size_t len = 0;
+  EXPECT_TRUE(m.visit(7, [&len](const std::string& s) { len = s.size(); }));
+  EXPECT_EQ(len, 5u);
+  EXPECT_FALSE(m.visit(8, [&len](const std::string&) { len = 0; }));
+  EXPECT_EQ(len, 5u);
+}
+
+TEST(ConcurrentMapTest, ConcurrentReadersAndWriters) {
+  concurrent_unordered_map<int, int> m(16, 2);
+  constexpr int kWriters = 4;
+  constexpr int kPerWriter = 5000;
+  std::atomic<bool> done{false};
+  std::atomic<int> bad{0};
+
+  std::thread readers[4];
+  for (auto& r : readers) {
+    r = std::thread([&] {
+      while (!done.load()) {
+        for (int k = 0; k < kWriters * kPerWriter; k += 97) {
+          std::optional<int> v = m.find(k);
+          if (v && *v != k) bad++;
+        }
+      }
+    });
+  }
+  std::thread writers[kWriters];
+  for (int w = 0; w < kWriters; w++) {
+    writers[w] = std::thread([&m, w] {
+      for (int i = 0; i < kPerWriter; i++) {
+        int k = w * kPerWriter + i;
+        m.insert(k, k);
+      }
+    });
+  }
+  for (auto& w : writers) w.join();
+  done = true;
+  for (auto& r : readers) r.join();
+
+  EXPECT_EQ(bad.load(), 0);
+  EXPECT_EQ(m.size(), static_cast<size_t>(kWriters * kPerWriter));
+}
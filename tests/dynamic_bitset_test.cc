@@ -0,0 +1,169 @@
+#include "dynamic_bitset/dynamic_bitset.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+using tjs::dynamic_bitset;
+
+TEST(DynamicBitsetTest, SetTestAndCount) {
+  dynamic_bitset bs(130);
+  EXPECT_EQ(bs.size(), 130u);
+  EXPECT_EQ(bs.word_count(), 3u);
+  EXPECT_TRUE(bs.none());
+
+  bs.set(0).set(64).set(129);
+  EXPECT_TRUE(bs.test(64));
+  EXPECT_FALSE(bs.test(65));
+  EXPECT_EQ(bs.count(), 3u);
+  EXPECT_THROW(bs.test(130), std::out_of_range);
+
+  bs.reset(64).flip(1);
+  EXPECT_FALSE(bs[64]);
+  EXPECT_TRUE(bs[1]);
+
+  bs.set();
+  EXPECT_TRUE(bs.all());
+  EXPECT_EQ(bs.count(), 130u);  // Bits past size() stay clear.
+  bs.flip();
+  EXPECT_TRUE(bs.none());
+}
+
+TEST(DynamicBitsetTest, WordParallelLogic) {
+  dynamic_bitset a(200), b(200);
+  for (size_t i = 0; i < 200; i += 2) a.set(i);
+  for (size_t i = 0; i < 200; i += 3) b.set(i);
+
+  EXPECT_EQ((a & b).count(), 34u);   // Multiples of 6.
+  EXPECT_EQ((a | b).count(), 133u);  // 100 + 67 - 34.
+  EXPECT_EQ((a ^ b).count(), 99u);
+
+  dynamic_bitset c(a);
+  c.and_not(b);
+  EXPECT_EQ(c.count(), 66u);
+  EXPECT_TRUE(c.test(2));
+  EXPECT_FALSE(c.test(6));
+
+  EXPECT_EQ((~a).count(), 100u);
+  EXPECT_TRUE((a & ~a).none());
+
+  dynamic_bitset other(100);
+  EXPECT_THROW(a &= other, std::invalid_argument);
+}
+
+TEST(DynamicBitsetTest, LogicWithItself) {
+  dynamic_bitset a(150);
+  for (size_t i = 0; i < 150; i += 5) a.set(i);
+  dynamic_bitset b(a);
+
+  b &= b;
+  EXPECT_TRUE(b == a);
+  b |= b;
+  EXPECT_TRUE(b == a);
+  b ^= b;
+  EXPECT_TRUE(b.none());
+  a.and_not(a);
+  EXPECT_TRUE(a.none());
+}
+
+TEST(DynamicBitsetTest, FindFirstAndNext) {
+  dynamic_bitset bs(300);
+  EXPECT_EQ(bs.find_first(), dynamic_bitset::npos);
+
+  bs.set(5).set(63).set(64).set(250);
+  EXPECT_EQ(bs.find_first(), 5u);
+  EXPECT_EQ(bs.find_next(5), 63u);
+  EXPECT_EQ(bs.find_next(63), 64u);
+  EXPECT_EQ(bs.find_next(64), 250u);
+  EXPECT_EQ(bs.find_next(250), dynamic_bitset::npos);
+  EXPECT_EQ(bs.find_next(299), dynamic_bitset::npos);
+
+  size_t visited = 0;
+  for (size_t i = bs.find_first(); i != dynamic_bitset::npos;
+       i = bs.find_next(i)) {
+    visited++;
+  }
+  EXPECT_EQ(visited, 4u);
+}
+
+TEST(DynamicBitsetTest, ResizePushBackAndEquality) {
+  dynamic_bitset bs;
+  EXPECT_TRUE(bs.empty());
+  for (int i = 0; i < 70; i++) bs.push_back(i == 69);
+  EXPECT_EQ(bs.size(), 70u);
+  EXPECT_EQ(bs.find_first(), 69u);
+
+  bs.resize(200, true);
+  EXPECT_EQ(bs.count(), 131u);
+  bs.resize(10);
+  EXPECT_EQ(bs.size(), 10u);
+  EXPECT_TRUE(bs.none());
+
+  dynamic_bitset a(10);
+  EXPECT_TRUE(a == bs);
+  a.set(3);
+  EXPECT_TRUE(a != bs);
+
+  std::ostringstream os;
+  os << a;
+  EXPECT_EQ(os.str(), "0001000000");
+}
+
+TEST(DynamicBitsetTest, ResizeTrueWithinPartialWord) {
+  // Growing inside the last word must keep the bits below the old size.
+  dynamic_bitset a(3);
+  a.resize(5, true);
+  std::ostringstream os;
+  os << a;
+  EXPECT_EQ(os.str(), "00011");
+
+  dynamic_bitset b(70);
+  b.set(1);
+  b.set(66);
+  b.resize(100, true);
+  EXPECT_EQ(b.count(), 32u);
+  EXPECT_TRUE(b.test(1));
+  EXPECT_FALSE(b.test(2));
+  EXPECT_TRUE(b.test(66));
+  EXPECT_FALSE(b.test(69));
+  EXPECT_TRUE(b.test(70));
+  EXPECT_TRUE(b.test(99));
+}
+
+TEST(DynamicBitsetTest, CopyMoveAndGrowth) {
+  dynamic_bitset a(300);
+  EXPECT_EQ(a.word_count(), 5u);
+  a.set(7).set(299);
+
+  dynamic_bitset b(a);
+  b.reset(7);
+  EXPECT_TRUE(a.test(7));
+  EXPECT_EQ(b.count(), 1u);
+
+  dynamic_bitset c(std::move(b));
+  EXPECT_EQ(c.count(), 1u);
+  EXPECT_TRUE(b.empty());
+
+  b = a;
+  EXPECT_TRUE(b == a);
+  c = std::move(a);
+  EXPECT_TRUE(c == b);
+
+  // push_back grows past a resize, resize shrinks back to exact words.
+  for (int i = 0; i < 100; i++) c.push_back(i % 2 == 0);
+  EXPECT_EQ(c.size(), 400u);
+  EXPECT_EQ(c.word_count(), 7u);
+  EXPECT_EQ(c.count(), 52u);
+  c.resize(64);
+  EXPECT_EQ(c.word_count(), 1u);
+  EXPECT_EQ(c.count(), 1u);
+  c.resize(128);
+  EXPECT_EQ(c.count(), 1u);
+
+  dynamic_bitset d;
+  for (int i = 0; i < 130; i++) d.push_back(true);
+  EXPECT_TRUE(d.all());
+  EXPECT_EQ(d.word_count(), 3u);
+}
@@ -0,0 +1,128 @@
+#include "intrusive_list/intrusive_list.h"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+
+using tjs::intrusive_list;
+using tjs::intrusive_list_hook;
+
+struct LruTag {};
+
+struct Entry : intrusive_list_hook<>, intrusive_list_hook<LruTag> {
+  int key;
+  explicit Entry(int k) : key(k) {}
+};
+
+static int keys_sum(intrusive_list<Entry>& l) {
+  int sum = 0;
+  for (Entry& e : l) sum = sum * 10 + e.key;
+  return sum;
+}
+
+TEST(IntrusiveListTest, PushAndIterate) {
+  Entry a(1), b(2), c(3);
+  intrusive_list<Entry> l;
+  EXPECT_TRUE(l.empty());
+
+  l.push_back(b);
+  l.push_back(c);
+  l.push_front(a);
+  EXPECT_EQ(l.size(), 3u);
+  EXPECT_EQ(keys_sum(l), 123);
+  EXPECT_EQ(l.front().key, 1);
+  EXPECT_EQ(l.back().key, 3);
+
+  auto it = l.end();
+  --it;
+  EXPECT_EQ(it->key, 3);
+  EXPECT_TRUE(static_cast<intrusive_list_hook<>&>(b).is_linked());
+}
+
+TEST(IntrusiveListTest, UnlinkFromElementAndAutoUnlink) {
+  Entry a(1), c(3);
+  intrusive_list<Entry> l;
+  l.push_back(a);
+  {
+    Entry b(2);
+    l.push_back(b);
+    l.push_back(c);
+    EXPECT_EQ(keys_sum(l), 123);
+  }  // b unlinks itself on destruction.
+  EXPECT_EQ(keys_sum(l), 13);
+
+  static_cast<intrusive_list_hook<>&>(a).unlink();
+  EXPECT_EQ(keys_sum(l), 3);
+  EXPECT_FALSE(static_cast<intrusive_list_hook<>&>(a).is_linked());
+
+  l.clear();
+  EXPECT_TRUE(l.empty());
+  EXPECT_FALSE(static_cast<intrusive_list_hook<>&>(c).is_linked());
+}
+
+TEST(IntrusiveListTest, InsertEraseAndIteratorTo) {
+  Entry a(1), b(2), c(3);
+  intrusive_list<Entry> l;
+  l.push_back(a);
+  l.push_back(c);
+  auto it = l.insert(intrusive_list<Entry>::iterator_to(c), b);
+  EXPECT_EQ(it->key, 2);
+  EXPECT_EQ(keys_sum(l), 123);
+
+  it = l.erase(it);
+  EXPECT_EQ(it->key, 3);
+  EXPECT_EQ(keys_sum(l), 13);
+
+  l.pop_front();
+  l.pop_back();
+  EXPECT_TRUE(l.empty());
+}
+
+TEST(IntrusiveListTest, Splice) {
+  Entry e1(1), e2(2), e3(3), e4(4), e5(5);
+  intrusive_list<Entry> x, y;
+  x.push_back(e1);
+  x.push_back(e2);
+  y.push_back(e3);
+  y.push_back(e4);
+  y.push_back(e5);
+
+  // Single element.
+  x.splice(x.begin(), y, intrusive_list<Entry>::iterator_to(e4));
+  EXPECT_EQ(keys_sum(x), 412);
+  EXPECT_EQ(keys_sum(y), 35);
+
+  // Whole list.
+  x.splice(x.end(), y);
+  EXPECT_EQ(keys_sum(x), 41235);
+  EXPECT_TRUE(y.empty());
+
+  // Range within the same list, LRU style move to front.
+  auto first = intrusive_list<Entry>::iterator_to(e3);
+  x.splice(x.begin(), x, first, x.end());
+  EXPECT_EQ(keys_sum(x), 35412);
+
+  // Moving an element in front of itself is a no-op.
+  x.splice(x.begin(), x, x.begin());
+  EXPECT_EQ(keys_sum(x), 35412);
+
+  // Move construction keeps the elements linked.
+  intrusive_list<Entry> z(std::move(x));
+  EXPECT_TRUE(x.empty());
+  EXPECT_EQ(keys_sum(z), 35412);
+}
+
+TEST(IntrusiveListTest, ObjectInTwoListsWithTags) {
+  Entry a(1), b(2);
+  intrusive_list<Entry> all;
+  intrusive_list<Entry, LruTag> lru;
+  all.push_back(a);
+  all.push_back(b);
+  lru.push_back(b);
+  lru.push_back(a);
+
+  EXPECT_EQ(lru.front().key, 2);
+  static_cast<intrusive_list_hook<LruTag>&>(b).unlink();
+  EXPECT_EQ(lru.front().key, 1);
+  EXPECT_EQ(all.size(), 2u);
+}
@@ -0,0 +1,225 @@
+#include "list/list.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using tjs::list;
+
+static std::string joined(list<std::string>& l) {
+  std::string out;
+  for (const std::string& s : l) out += s;
+  return out;
+}
+
+static int digits(list<int>& l) {
+  int out = 0;
+  for (int x : l) out = out * 10 + x;
+  return out;
+}
+
+TEST(ListTest, PushPopAndAccess) {
+  list<int> l;
+  EXPECT_TRUE(l.empty());
+  l.push_back(2);
+  l.push_back(3);
+  l.push_front(1);
+  EXPECT_EQ(l.size(), 3u);
+  EXPECT_EQ(l.front(), 1);
+  EXPECT_EQ(l.back(), 3);
+  EXPECT_EQ(digits(l), 123);
+
+  l.pop_front();
+  l.pop_back();
+  EXPECT_EQ(l.size(), 1u);
+  EXPECT_EQ(l.front(), 2);
+}
+
+TEST(ListTest, EmplaceInsertErase) {
+  list<std::string> l;
+  l.emplace_back(3, 'b');
+  l.emplace_front("a");
+  auto it = l.insert(l.end(), "c");
+  EXPECT_EQ(*it, "c");
+  EXPECT_EQ(joined(l), "abbbc");
+
+  it = l.begin();
+  ++it;
+  it = l.erase(it);
+  EXPECT_EQ(*it, "c");
+  EXPECT_EQ(joined(l), "ac");
+  EXPECT_EQ(it->size(), 1u);
+
+  --it;
+  EXPECT_EQ(*it, "a");
+}
+
+TEST(ListTest, CopyAndMove) {
+  list<int> a{1, 2, 3};
+  list<int> b(a);
+  b.push_back(4);
+  EXPECT_EQ(digits(a), 123);
+  EXPECT_EQ(digits(b), 1234);
+
+  list<int> c(std::move(b));
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(digits(c), 1234);
+  b.push_back(9);  // Moved-from lists stay usable.
+  EXPECT_EQ(digits(b), 9);
+
+  a = c;
+  EXPECT_EQ(digits(a), 1234);
+  a = std::move(b);
+  EXPECT_EQ(digits(a), 9);
+}
+
+TEST(ListTest, NodesAreRecycled) {
+  list<int> l;
+  for (int i = 0; i < 100; i++) l.push_back(i);
+  int* first = &l.front();
+  l.clear();
+  EXPECT_TRUE(l.empty());
+
+  // The most recently freed node is handed out first.
+  for (int i = 0; i < 100; i++) l.push_back(i);
+  EXPECT_EQ(l.size(), 100u);
+  EXPECT_EQ(&l.back(), first);
+}
+
+TEST(ListTest, SpliceBetweenLists) {
+  list<int>::node_pool pool;
+  list<int> x(pool);
+  list<int> y(pool);
+  for (int i : {1, 2}) x.push_back(i);
+  for (int i : {3, 4, 5}) y.push_back(i);
+
+  auto it = y.begin();
+  ++it;
+  x.splice(x.begin(), y, it);
+  EXPECT_EQ(digits(x), 412);
+  EXPECT_EQ(x.size(), 3u);
+  EXPECT_EQ(y.size(), 2u);
+
+  x.splice(x.end(), y);
+  EXPECT_EQ(digits(x), 41235);
+  EXPECT_EQ(x.size(), 5u);
+  EXPECT_TRUE(y.empty());
+
+  // Range back into y.
+  auto first = x.begin();
+  ++first;
+  auto last = first;
+  ++last;
+  ++last;
+  y.splice(y.begin(), x, first, last);
+  EXPECT_EQ(digits(y), 12);
+  EXPECT_EQ(digits(x), 435);
+  EXPECT_EQ(y.size(), 2u);
+  EXPECT_EQ(x.size(), 3u);
+}
+
+TEST(ListTest, SpliceWithSharedPoolMovesNodes) {
+  list<std::string>::node_pool pool;
+  list<std::string> x(pool);
+  list<std::string> y(x.get_pool());
+  EXPECT_TRUE(x.get_pool() == pool);
+  x.push_back("a");
+  y.push_back("b");
+  y.push_back("c");
+
+  // Same pool: the node itself changes lists.
+  std::string* b = &y.front();
+  x.splice(x.end(), y, y.begin());
+  EXPECT_EQ(&x.back(), b);
+  x.splice(x.begin(), y);
+  EXPECT_EQ(joined(x), "cab");
+  EXPECT_TRUE(y.empty());
+
+  // Nodes freed by one list are reused by the other.
+  x.pop_back();
+  y.push_back("d");
+  EXPECT_EQ(&y.front(), b);
+}
+
+TEST(ListTest, SpliceWithoutSharedPoolThrows) {
+  // Moving elements instead would silently invalidate iterators into
+  // them, so splicing across pools is rejected.
+  list<std::string> x{"a", "b"};
+  list<std::string> y{"c"};
+  auto kept = y.begin();
+  EXPECT_THROW(x.splice(x.end(), y), std::invalid_argument);
+  EXPECT_THROW(x.splice(x.end(), y, y.begin()), std::invalid_argument);
+  EXPECT_THROW(x.splice(x.begin(), y, y.begin(), y.end()),
+               std::invalid_argument);
+  EXPECT_EQ(joined(x), "ab");
+  EXPECT_EQ(y.size(), 1u);
+  EXPECT_EQ(*kept, "c");
+
+  // Nothing to move, nothing to reject.
+  list<std::string> empty;
+  x.splice(x.end(), empty);
+  x.splice(x.end(), y, y.begin(), y.begin());
+  EXPECT_EQ(x.size(), 2u);
+
+  // Splicing within one list is always fine.
+  x.splice(x.begin(), x, --x.end());
+  EXPECT_EQ(joined(x), "ba");
+}
+
+TEST(ListTest, MoveKeepsPoolSharing) {
+  list<int>::node_pool pool;
+  list<int> a(pool);
+  a.push_back(1);
+  list<int> b(std::move(a));
+  EXPECT_TRUE(a.get_pool() == b.get_pool());
+  a.push_back(2);
+  b.splice(b.end(), a, a.begin());
+  EXPECT_EQ(digits(b), 12);
+
+  // Move assignment between different pools keeps the target's pool.
+  list<int> c;
+  c.push_back(5);
+  c = std::move(b);
+  EXPECT_EQ(digits(c), 12);
+  EXPECT_TRUE(c.get_pool() != pool);
+}
+
+// Counts constructions, so a splice that copies or moves elements shows up.
+struct tracked {
+  static int constructions;
+  int value;
+  explicit tracked(int v) : value(v) { constructions++; }
+  tracked(const tracked& o) : value(o.value) { constructions++; }
+  tracked(tracked&& o) : value(o.value) { constructions++; }
+};
+int tracked::constructions = 0;
+
+TEST(ListTest, SpliceCostIndependentOfDonorCount) {
+  // Many short-lived donors each hand one node to a long-lived list, which
+  // then passes them on one at a time. Splices relink nodes without
+  // touching elements, and no list keeps state about the donors: the one
+  // shared pool's reference count is back to its baseline once they are
+  // gone and stays there.
+  list<tracked>::node_pool pool;
+  list<tracked> keep(pool);
+  list<tracked> out(pool);
+  ASSERT_EQ(pool.use_count(), 3u);
+
+  const int donors = 5000;
+  for (int i = 0; i < donors; i++) {
+    list<tracked> donor(pool);
+    donor.emplace_back(i);
+    keep.splice(keep.end(), donor, donor.begin());
+  }
+  EXPECT_EQ(pool.use_count(), 3u);
+
+  int before = tracked::constructions;
+  while (!keep.empty()) out.splice(out.end(), keep, keep.begin());
+  EXPECT_EQ(tracked::constructions, before);
+  EXPECT_EQ(pool.use_count(), 3u);
+  EXPECT_TRUE(out.get_pool() == pool);
+  EXPECT_EQ(out.size(), static_cast<size_t>(donors));
+  EXPECT_EQ(out.back().value, donors - 1);
+}
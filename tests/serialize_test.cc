@@ -0,0 +1,139 @@
+#include "serialize/serialize.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using tjs::binary_reader;
+using tjs::binary_writer;
+using tjs::string;
+using tjs::vector;
+
+// Copies the stream contents into an 8 byte aligned buffer, like a file
+// read into heap memory or mapped with mmap.
+static vector<uint64_t> to_buffer(const std::ostringstream& os) {
+  std::string bytes = os.str();
+  vector<uint64_t> buf((bytes.size() + 7) / 8);
+  std::memcpy(buf.data(), bytes.data(), bytes.size());
+  return buf;
+}
+
+struct Point {
+  int32_t x;
+  int32_t y;
+  double weight;
+};
+
+TEST(SerializeTest, PodVectorRoundTrip) {
+  vector<int> v{1, 2, 3, 4, 5};
+  std::ostringstream os;
+  binary_writer w(os);
+  w.write(v);
+  EXPECT_EQ(w.bytes_written() % 8, 0u);
+
+  std::string bytes = os.str();
+  vector<uint64_t> buf = to_buffer(os);
+  binary_reader r(buf.data(), bytes.size());
+  vector<int> out = r.read_vector<int>();
+  ASSERT_EQ(out.size(), 5u);
+  for (size_t i = 0; i < out.size(); i++) EXPECT_EQ(out[i], v[i]);
+  EXPECT_TRUE(r.at_end());
+}
+
+TEST(SerializeTest, StructVectorView) {
+  vector<Point> pts;
+  pts.push_back({1, 2, 0.5});
+  pts.push_back({-3, 4, 1.5});
+
+  std::ostringstream os;
+  binary_writer(os).write(pts);
+  std::string bytes = os.str();
+  vector<uint64_t> buf = to_buffer(os);
+
+  binary_reader r(buf.data(), bytes.size());
+  tjs::vector_view<Point> view = r.view_vector<Point>();
+  ASSERT_EQ(view.size(), 2u);
+  EXPECT_EQ(view[1].x, -3);
+  EXPECT_EQ(view[1].weight, 1.5);
+  // The view points straight into the buffer, nothing was copied.
+  EXPECT_EQ(reinterpret_cast<const char*>(view.data()),
+            reinterpret_cast<const char*>(buf.data()) +
+                sizeof(tjs::blob_header));
+  EXPECT_THROW(view[2], std::out_of_range);
+}
+
+TEST(SerializeTest, StringAndStringVectorRoundTrip) {
+  string s("a string long enough to leave the sso buffer");
+  vector<string> words;
+  words.push_back(string("alpha"));
+  words.push_back(string(""));
+  words.push_back(string("gamma delta epsilon zeta eta theta"));
+
+  std::ostringstream os;
+  binary_writer w(os);
+  w.write(s);
+  w.write(words);
+  std::string bytes = os.str();
+  vector<uint64_t> buf = to_buffer(os);
+
+  binary_reader r(buf.data(), bytes.size());
+  string s_out = r.read_string();
+  EXPECT_STREQ(s_out.c_str(), s.c_str());
+  vector<string> words_out = r.read_string_vector();
+  ASSERT_EQ(words_out.size(), 3u);
+  for (size_t i = 0; i < words.size(); i++)
+    EXPECT_STREQ(words_out[i].c_str(), words[i].c_str());
+  EXPECT_TRUE(r.at_end());
+
+  binary_reader rv(buf.data(), bytes.size());
+  EXPECT_EQ(rv.view_string(), s.c_str());
+  tjs::string_vector_view view = rv.view_string_vector();
+  ASSERT_EQ(view.size(), 3u);
+  EXPECT_EQ(view[0], "alpha");
+  EXPECT_TRUE(view[1].empty());
+  EXPECT_EQ(view[2], "gamma delta epsilon zeta eta theta");
+}
+
+TEST(SerializeTest, EmptyContainers) {
+  std::ostringstream os;
+  binary_writer w(os);
+  w.write(vector<double>(0));
+  w.write(string());
+  w.write(vector<string>(0));
+  std::string bytes = os.str();
+  vector<uint64_t> buf = to_buffer(os);
+
+  binary_reader r(buf.data(), bytes.size());
+  EXPECT_TRUE(r.read_vector<double>().empty());
+  EXPECT_TRUE(r.read_string().empty());
+  EXPECT_TRUE(r.read_string_vector().empty());
+  EXPECT_TRUE(r.at_end());
+}
+
+TEST(SerializeTest, MalformedInputThrows) {
+  vector<int> v{1, 2, 3};
+  std::ostringstream os;
+  binary_writer(os).write(v);
+  std::string bytes = os.str();
+  vector<uint64_t> buf = to_buffer(os);
+
+  // Wrong element type.
+  binary_reader wrong_type(buf.data(), bytes.size());
+  EXPECT_THROW(wrong_type.read_vector<double>(), std::runtime_error);
+
+  // Wrong blob kind.
+  binary_reader wrong_kind(buf.data(), bytes.size());
+  EXPECT_THROW(wrong_kind.read_string(), std::runtime_error);
+
+  // Truncated payload.
+  binary_reader truncated(buf.data(), sizeof(tjs::blob_header) + 4);
+  EXPECT_THROW(truncated.read_vector<int>(), std::runtime_error);
+
+  // Bad magic.
+  reinterpret_cast<char*>(buf.data())[0] = 'X';
+  binary_reader bad_magic(buf.data(), bytes.size());
+  EXPECT_THROW(bad_magic.read_vector<int>(), std::runtime_error);
+}
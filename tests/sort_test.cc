@@ -0,0 +1,217 @@
+#include "algorithms/sort.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "string/string.h"
+#include "vector/vector.h"
+
+static std::vector<int> random_ints(size_t n, int lo, int hi,
+                                    unsigned seed = 1) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> dist(lo, hi);
+  std::vector<int> v(n);
+  for (int& x : v) x = dist(rng);
+  return v;
+}
+
+TEST(SortTest, EmptyAndSingle) {
+  std::vector<int> v;
+  tjs::sort(v.begin(), v.end());
+  EXPECT_TRUE(v.empty());
+  v.push_back(7);
+  tjs::sort(v.begin(), v.end());
+  EXPECT_EQ(v[0], 7);
+}
+
+TEST(SortTest, MatchesStdSortOnRandomInput) {
+  for (size_t n : {2u, 10u, 23u, 24u, 100u, 129u, 1000u, 50000u}) {
+    std::vector<int> v = random_ints(n, -1000, 1000, n);
+    std::vector<int> expected = v;
+    std::sort(expected.begin(), expected.end());
+    tjs::sort(v.begin(), v.end());
+    EXPECT_EQ(v, expected) << "n = " << n;
+  }
+}
+
+TEST(SortTest, Patterns) {
+  const size_t n = 10000;
+  std::vector<int> sorted(n), reversed(n), equal(n, 3), sawtooth(n);
+  for (size_t i = 0; i < n; i++) {
+    sorted[i] = i;
+    reversed[i] = n - i;
+    sawtooth[i] = i % 17;
+  }
+  for (std::vector<int>* v : {&sorted, &reversed, &equal, &sawtooth}) {
+    std::vector<int> expected = *v;
+    std::sort(expected.begin(), expected.end());
+    tjs::sort(v->begin(), v->end());
+    EXPECT_EQ(*v, expected);
+  }
+}
+
+TEST(SortTest, FewDistinctValues) {
+  std::vector<int> v = random_ints(20000, 0, 3);
+  std::vector<int> expected = v;
+  std::sort(expected.begin(), expected.end());
+  tjs::sort(v.begin(), v.end());
+  EXPECT_EQ(v, expected);
+}
+
+TEST(SortTest, CustomComparators) {
+  std::vector<int> v = random_ints(5000, -100, 100);
+  std::vector<int> expected = v;
+  std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+  std::vector<int> a = v;
+  tjs::sort(a.begin(), a.end(), tjs::greater<>());
+  EXPECT_EQ(a, expected);
+
+  // A lambda takes the branchy partition.
+  std::vector<int> b = v;
+  tjs::sort(b.begin(), b.end(), [](int x, int y) { return x > y; });
+  EXPECT_EQ(b, expected);
+}
+
+TEST(SortTest, SortsTjsVectorAndStrings) {
+  tjs::vector<tjs::string> v;
+  std::vector<std::string> expected;
+  std::mt19937 rng(5);
+  for (int i = 0; i < 500; i++) {
+    std::string s;
+    for (int j = rng() % 6; j > 0; j--) s += char('a' + rng() % 3);
+    v.push_back(tjs::string(s.c_str()));
+    expected.push_back(s);
+  }
+  std::sort(expected.begin(), expected.end());
+  tjs::sort(v.begin(), v.end());
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_STREQ(v[i].c_str(), expected[i].c_str());
+  }
+}
+
+TEST(RadixSortTest, UnsignedAndSigned) {
+  std::mt19937_64 rng(9);
+  std::vector<uint32_t> u(10000);
+  for (uint32_t& x : u) x = rng();
+  std::vector<uint32_t> u_expected = u;
+  std::sort(u_expected.begin(), u_expected.end());
+  tjs::radix_sort(u.begin(), u.end());
+  EXPECT_EQ(u, u_expected);
+
+  std::vector<int64_t> s(10000);
+  for (int64_t& x : s) x = static_cast<int64_t>(rng());
+  s[0] = INT64_MIN;
+  s[1] = INT64_MAX;
+  s[2] = 0;
+  std::vector<int64_t> s_expected = s;
+  std::sort(s_expected.begin(), s_expected.end());
+  tjs::radix_sort(s.begin(), s.end());
+  EXPECT_EQ(s, s_expected);
+}
+
+TEST(RadixSortTest, Floats) {
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  std::vector<double> d(5000);
+  for (double& x : d) x = dist(rng);
+  d[0] = 0.0;
+  d[1] = -1e-300;
+  std::vector<double> expected = d;
+  std::sort(expected.begin(), expected.end());
+  tjs::radix_sort(d.begin(), d.end());
+  EXPECT_EQ(d, expected);
+
+  std::vector<float> f = {3.5f, -2.0f, 0.0f, -0.5f, 1e10f, -1e10f};
+  tjs::radix_sort(f.begin(), f.end());
+  EXPECT_EQ(f, (std::vector<float>{-1e10f, -2.0f, -0.5f, 0.0f, 3.5f, 1e10f}));
+}
+
+TEST(RadixSortTest, StableByKey) {
+  struct record {
+    uint64_t timestamp;
+    int id;
+  };
+  // Timestamps share their high bytes, so most passes are skipped.
+  std::vector<record> v;
+  std::mt19937 rng(11);
+  for (int i = 0; i < 3000; i++) {
+    v.push_back({1700000000000ull + rng() % 500, i});
+  }
+  std::vector<record> expected = v;
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const record& a, const record& b) {
+                     return a.timestamp < b.timestamp;
+                   });
+  tjs::radix_sort(v.begin(), v.end(),
+                  [](const record& r) { return r.timestamp; });
+  for (size_t i = 0; i < v.size(); i++) {
+    EXPECT_EQ(v[i].timestamp, expected[i].timestamp);
+    EXPECT_EQ(v[i].id, expected[i].id);
+  }
+}
+
+TEST(RadixSortTest, OddAndEvenPassCounts) {
+  // One byte varies (the result ends in the scratch buffer), then two.
+  for (uint32_t spread : {0xffu, 0xffffu}) {
+    std::mt19937 rng(spread);
+    std::vector<uint32_t> v(1000);
+    for (uint32_t& x : v) x = 0x12340000u + rng() % spread;
+    std::vector<uint32_t> expected = v;
+    std::sort(expected.begin(), expected.end());
+    tjs::radix_sort(v.begin(), v.end());
+    EXPECT_EQ(v, expected) << "spread = " << spread;
+  }
+}
+
+TEST(RadixSortTest, SmallRangeIsStable) {
+  std::vector<std::pair<int, int>> v = {{3, 0}, {1, 1}, {3, 2}, {-1, 3},
+                                        {1, 4}};
+  tjs::radix_sort(v.begin(), v.end(),
+                  [](const std::pair<int, int>& p) { return p.first; });
+  std::vector<std::pair<int, int>> expected = {{-1, 3}, {1, 1}, {1, 4},
+                                               {3, 0}, {3, 2}};
+  EXPECT_EQ(v, expected);
+}
+
+TEST(RadixSortTest, Strings) {
+  tjs::vector<tjs::string> v;
+  std::vector<std::string> expected;
+  std::mt19937 rng(17);
+  for (int i = 0; i < 2000; i++) {
+    // Many strings share their first 8 bytes and differ after them.
+    std::string s = (i % 3 == 0) ? "prefix__" : "";
+    for (int j = rng() % 12; j > 0; j--) s += char('a' + rng() % 4);
+    v.push_back(tjs::string(s.c_str()));
+    expected.push_back(s);
+  }
+  std::sort(expected.begin(), expected.end());
+  tjs::radix_sort(v.begin(), v.end());
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_STREQ(v[i].c_str(), expected[i].c_str());
+  }
+}
+
+TEST(ParallelSortTest, MatchesStdSort) {
+  std::vector<int> v = random_ints(300000, -100000, 100000);
+  std::vector<int> expected = v;
+  std::sort(expected.begin(), expected.end());
+  for (size_t threads : {0u, 1u, 2u, 3u, 8u}) {
+    std::vector<int> w = v;
+    tjs::parallel_sort(w.begin(), w.end(), tjs::less<>(), threads);
+    EXPECT_EQ(w, expected) << "threads = " << threads;
+  }
+}
+
+TEST(ParallelSortTest, SmallRangeAndComparator) {
+  std::vector<int> v = random_ints(1000, 0, 50);
+  std::vector<int> expected = v;
+  std::sort(expected.begin(), expected.end(), std::greater<int>());
+  tjs::parallel_sort(v.begin(), v.end(), tjs::greater<>(), 4);
+  EXPECT_EQ(v, expected);
+}
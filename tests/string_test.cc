@@ -180,3 +180,65 @@ TEST(StringTest, CopyAssignmentAndMoveAssignment) {
   EXPECT_EQ(b.size(), 0u);
   EXPECT_STREQ(b.c_str(), "");
 }
+
+TEST(StringTest, AppendNumber) {
+  string s("n=");
+  s.append_number(42);
+  s.push_back(' ');
+  s.append_number(-9223372036854775807LL - 1);
+  s.push_back(' ');
+  s.append_number(18446744073709551615ULL);
+  EXPECT_STREQ(s.c_str(), "n=42 -9223372036854775808 18446744073709551615");
+
+  // Shortest round-trip floating point.
+  string f;
+  f.append_number(0.1);
+  f.push_back(' ');
+  f.append_number(1.5f);
+  f.push_back(' ');
+  f.append_number(1e300);
+  EXPECT_STREQ(f.c_str(), "0.1 1.5 1e+300");
+
+  // Grows out of the SSO buffer.
+  string big;
+  for (int i = 0; i < 100; ++i) big.append_number(i);
+  EXPECT_EQ(big.size(), 190u);
+  EXPECT_EQ(big[189], '9');
+}
+
+TEST(StringTest, AppendFormat) {
+  string s;
+  s.append_format("{} took {}ms ({}) {}", "query", 12.5, string("ok"), 'x');
+  EXPECT_STREQ(s.c_str(), "query took 12.5ms (ok) x");
+
+  s.clear();
+  s.append_format("{{{}}} {}", 7u, true);
+  EXPECT_STREQ(s.c_str(), "{7} true");
+
+  string t;
+  EXPECT_THROW(t.append_format("{} {}", 1), std::invalid_argument);
+  EXPECT_THROW(t.append_format("{}", 1, 2), std::invalid_argument);
+  EXPECT_THROW(t.append_format("{ }", 1), std::invalid_argument);
+}
+
+TEST(StringTest, ParseNumber) {
+  string s("123 -4.25 abc 99999999999");
+  int i = 0;
+  EXPECT_EQ(s.parse_number(i), 3u);
+  EXPECT_EQ(i, 123);
+
+  double d = 0;
+  EXPECT_EQ(s.parse_number(d, 4), 5u);
+  EXPECT_EQ(d, -4.25);
+
+  EXPECT_THROW(s.parse_number(i, 10), std::invalid_argument);
+  EXPECT_THROW(s.parse_number(i, 14), std::out_of_range);
+  EXPECT_THROW(s.parse_number(i, 100), std::out_of_range);
+
+  // Round trip through append_number.
+  string r;
+  r.append_number(0.30000000000000004);
+  double back = 0;
+  r.parse_number(back);
+  EXPECT_EQ(back, 0.30000000000000004);
+}
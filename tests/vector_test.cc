@@ -142,3 +142,75 @@ TEST(VecTest, RangeForSupport) {
 
   EXPECT_EQ(expected, 4);
 }
+
+TEST(VecBoolTest, PackedPushBackAndAccess) {
+  vector<bool> v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.capacity(), 64u);
+
+  for (int i = 0; i < 200; i++) v.push_back(i % 3 == 0);
+  EXPECT_EQ(v.size(), 200u);
+  EXPECT_EQ(v.capacity(), 256u);
+  for (size_t i = 0; i < v.size(); i++) EXPECT_EQ(v[i], i % 3 == 0);
+  EXPECT_EQ(v.count(), 67u);
+  EXPECT_THROW(v[200], std::out_of_range);
+
+  // Reference proxy writes through to the packed word.
+  v[1] = true;
+  v[0] = false;
+  EXPECT_TRUE(v[1]);
+  EXPECT_FALSE(v[0]);
+  v[2] = v[1];
+  EXPECT_TRUE(v[2]);
+  v[2].flip();
+  EXPECT_FALSE(v[2]);
+}
+
+TEST(VecBoolTest, ConstructorsCopyAndMove) {
+  vector<bool> v{true, false, true, true};
+  EXPECT_EQ(v.size(), 4u);
+  EXPECT_EQ(v.count(), 3u);
+
+  vector<bool> zeros(100);
+  EXPECT_EQ(zeros.size(), 100u);
+  EXPECT_EQ(zeros.count(), 0u);
+  EXPECT_EQ(zeros.capacity(), 128u);  // Whole words, not a power of two.
+  vector<bool> big(700);
+  EXPECT_EQ(big.capacity(), 704u);
+
+  vector<bool> copy(v);
+  copy[0] = false;
+  EXPECT_TRUE(v[0]);
+
+  vector<bool> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 4u);
+  EXPECT_FALSE(moved[0]);
+  EXPECT_EQ(copy.size(), 0u);
+
+  vector<bool> assigned;
+  assigned = v;
+  EXPECT_EQ(assigned.count(), 3u);
+}
+
+TEST(VecBoolTest, IteratorAcrossWords) {
+  vector<bool> v;
+  for (int i = 0; i < 150; i++) v.push_back(i % 2 == 1);
+
+  EXPECT_EQ(v.end() - v.begin(), 150);
+  int set = 0;
+  for (bool b : v) set += b;
+  EXPECT_EQ(set, 75);
+
+  auto it = v.begin() + 65;
+  EXPECT_TRUE(*it);
+  it -= 2;
+  EXPECT_TRUE(*it);
+  --it;
+  EXPECT_FALSE(*it);
+  EXPECT_EQ(it - v.begin(), 62);
+  EXPECT_TRUE(v.begin() < it);
+  EXPECT_TRUE(*(v.end() - 1));
+
+  for (auto w = v.begin(); w != v.end(); ++w) *w = true;
+  EXPECT_EQ(v.count(), 150u);
+}
@@ -1,10 +1,13 @@
 #ifndef TJS_VECTOR_H
 #define TJS_VECTOR_H
 
+#include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
 namespace tjs {
 
@@ -31,6 +34,7 @@ class vector {
   vector();
   explicit vector(size_t req_size);
   vector(std::initializer_list<T> l);
+  vector(const T* first, const T* last);
   vector(const vector& other);
   vector(vector&& other);
   vector& operator=(const vector& other);
@@ -50,6 +54,10 @@ class vector {
   bool empty() const;
   void reserve(size_t n);
 
+  // Direct access to the underlying array.
+  T* data();
+  const T* data() const;
+
   // Operator [] overloads.
   const T& operator[](size_t i) const;
   T& operator[](size_t i);
@@ -96,6 +104,134 @@ class vector {
   iterator end();
 };
 
+namespace detail {
+// Number of set bits in n words. Uses the popcnt instruction where the CPU
+// has it, even when the build does not target it, and a portable bit trick
+// otherwise.
+size_t popcount_words(const uint64_t* words, size_t n);
+}  // namespace detail
+
+// ------------------------------------------------------------------------
+// vector<bool> Specialization
+// ------------------------------------------------------------------------
+// Packs elements into 64 bit words, one bit each. Elements are accessed
+// through a reference proxy, and the iterator walks a (word, bit) pair.
+// Bits past size() are always kept zero.
+template <>
+class vector<bool> {
+ public:
+  using word_type = uint64_t;
+  static constexpr size_t WORD_BITS = 64;
+
+ private:
+  // ------------------------------------------------------------------------
+  // MEMBER VARIABLES
+  // ------------------------------------------------------------------------
+  size_t m_size = 0;            // How many bits are in the vector.
+  size_t m_capacity = 0;        // Capacity in bits, a multiple of WORD_BITS.
+  word_type* m_words = nullptr;  // Underlying word array.
+
+  // ------------------------------------------------------------------------
+  // PRIVATE MEMBER FUNCTIONS
+  // ------------------------------------------------------------------------
+  void change_capacity(size_t n);
+  void double_capacity();
+  static size_t bits_to_capacity(size_t bits);
+  static size_t words_for(size_t bits);
+
+ public:
+  // ------------------------------------------------------------------------
+  // Reference Proxy
+  // ------------------------------------------------------------------------
+  class reference {
+    word_type* word_;
+    word_type mask_;
+
+   public:
+    reference(word_type* word, word_type mask);
+    operator bool() const;
+    reference& operator=(bool b);
+    reference& operator=(const reference& o);
+    bool operator~() const;
+    void flip();
+  };
+
+  // ------------------------------------------------------------------------
+  // Big 5
+  // ------------------------------------------------------------------------
+  vector();
+  explicit vector(size_t req_size);
+  vector(std::initializer_list<bool> l);
+  vector(const vector& other);
+  vector(vector&& other);
+  vector& operator=(const vector& other);
+  vector& operator=(vector&& other);
+  ~vector();
+
+  // ------------------------------------------------------------------------
+  // Public Member Functions
+  // ------------------------------------------------------------------------
+  void push_back(bool elem);
+
+  template <typename... Args>
+  void emplace_back(Args&&... args);
+
+  size_t size() const;
+  size_t capacity() const;
+  bool empty() const;
+  void reserve(size_t n);
+
+  // Number of set bits, a word at a time.
+  size_t count() const;
+
+  // The packed words, words_for(size()) of them are in use.
+  word_type* words();
+  const word_type* words() const;
+
+  // Operator [] overloads.
+  bool operator[](size_t i) const;
+  reference operator[](size_t i);
+
+  // ------------------------------------------------------------------------
+  // Iterator
+  // ------------------------------------------------------------------------
+  class iterator {
+    word_type* word_;
+    size_t bit_;  // Bit within *word_, always below WORD_BITS.
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = bool;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = vector<bool>::reference;
+
+    iterator(word_type* word = nullptr, size_t bit = 0);
+    reference operator*() const;
+    iterator& operator++();
+    iterator operator++(int);
+    iterator& operator--();
+    iterator operator--(int);
+    iterator operator+(difference_type n) const;
+    iterator operator-(difference_type n) const;
+    difference_type operator-(const iterator& o) const;
+    iterator& operator+=(difference_type n);
+    iterator& operator-=(difference_type n);
+    reference operator[](difference_type n) const;
+    bool operator==(const iterator& o) const;
+    bool operator!=(const iterator& o) const;
+    bool operator<(const iterator& o) const;
+    bool operator>(const iterator& o) const;
+    bool operator<=(const iterator& o) const;
+    bool operator>=(const iterator& o) const;
+  };
+
+  iterator begin();
+  iterator end();
+};
+
+std::ostream& operator<<(std::ostream& os, const tjs::vector<bool>& vec);
+
 }  // namespace tjs
 
 #include "vector.tpp"
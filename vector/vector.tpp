@@ -60,6 +60,21 @@ vector<T>::vector(std::initializer_list<T> l)
   }
 }
 
+template <class T>
+vector<T>::vector(const T* first, const T* last)
+    : m_size(last - first),
+      m_capacity(next_power_of_two(m_size)),
+      m_arr(new T[m_capacity]) {
+  // Trivially copyable elements come across in one bulk copy.
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (m_size > 0) std::memcpy(m_arr, first, m_size * sizeof(T));
+  } else {
+    for (size_t i = 0; i < m_size; i++) {
+      m_arr[i] = first[i];
+    }
+  }
+}
+
 template <class T>
 vector<T>::vector(const vector& other)
     : m_size(other.m_size),
@@ -146,6 +161,16 @@ bool vector<T>::empty() const {
   return m_size == 0;
 }
 
+template <class T>
+T* vector<T>::data() {
+  return m_arr;
+}
+
+template <class T>
+const T* vector<T>::data() const {
+  return m_arr;
+}
+
 template <class T>
 const T& vector<T>::operator[](size_t i) const {
   if (i >= m_size)
@@ -298,4 +323,338 @@ typename vector<T>::iterator vector<T>::end() {
   return iterator(m_arr + m_size);
 }
 
+// ------------------------------------------------------------------------
+// vector<bool> Implementations
+// ------------------------------------------------------------------------
+// A full specialization is not a template, so everything below is inline.
+
+namespace detail {
+
+// Four accumulators keep independent popcounts in flight.
+#if defined(__GNUC__)
+__attribute__((always_inline))
+#endif
+inline size_t popcount_words_generic(const uint64_t* words, size_t n) {
+  size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+  size_t k = 0;
+  for (; k + 4 <= n; k += 4) {
+    c0 += __builtin_popcountll(words[k]);
+    c1 += __builtin_popcountll(words[k + 1]);
+    c2 += __builtin_popcountll(words[k + 2]);
+    c3 += __builtin_popcountll(words[k + 3]);
+  }
+  for (; k < n; k++) c0 += __builtin_popcountll(words[k]);
+  return c0 + c1 + c2 + c3;
+}
+
+// Without -mpopcnt (or a -march that has it) the builtin is a libgcc call,
+// so x86-64 also gets a popcnt clone of the loop, picked at runtime.
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__POPCNT__)
+__attribute__((target("popcnt"))) inline size_t popcount_words_popcnt(
+    const uint64_t* words, size_t n) {
+  return popcount_words_generic(words, n);
+}
+
+inline size_t popcount_words(const uint64_t* words, size_t n) {
+  static const bool has_popcnt = __builtin_cpu_supports("popcnt");
+  if (has_popcnt) return popcount_words_popcnt(words, n);
+  return popcount_words_generic(words, n);
+}
+#else
+inline size_t popcount_words(const uint64_t* words, size_t n) {
+  return popcount_words_generic(words, n);
+}
+#endif
+
+}  // namespace detail
+
+// Whole words, at least one; push_back's doubling supplies the growth.
+inline size_t vector<bool>::bits_to_capacity(size_t bits) {
+  size_t words = (bits + WORD_BITS - 1) / WORD_BITS;
+  return (words == 0 ? 1 : words) * WORD_BITS;
+}
+
+inline size_t vector<bool>::words_for(size_t bits) {
+  return (bits + WORD_BITS - 1) / WORD_BITS;
+}
+
+inline void vector<bool>::change_capacity(size_t n) {
+  if (n <= m_capacity) return;
+
+  m_capacity = bits_to_capacity(n);
+  word_type* new_words = new word_type[m_capacity / WORD_BITS]();
+  if (m_words != nullptr)
+    std::memcpy(new_words, m_words, words_for(m_size) * sizeof(word_type));
+  delete[] m_words;
+  m_words = new_words;
+}
+
+inline void vector<bool>::double_capacity() {
+  change_capacity(m_capacity << 1);
+}
+
+// ———— REFERENCE PROXY ————
+inline vector<bool>::reference::reference(word_type* word, word_type mask)
+    : word_(word), mask_(mask) {}
+
+inline vector<bool>::reference::operator bool() const {
+  return (*word_ & mask_) != 0;
+}
+
+inline vector<bool>::reference& vector<bool>::reference::operator=(bool b) {
+  if (b)
+    *word_ |= mask_;
+  else
+    *word_ &= ~mask_;
+  return *this;
+}
+
+inline vector<bool>::reference& vector<bool>::reference::operator=(
+    const reference& o) {
+  return *this = static_cast<bool>(o);
+}
+
+inline bool vector<bool>::reference::operator~() const {
+  return !static_cast<bool>(*this);
+}
+
+inline void vector<bool>::reference::flip() { *word_ ^= mask_; }
+
+// ———— BIG 5 ————
+inline vector<bool>::vector()
+    : m_size(0),
+      m_capacity(WORD_BITS),
+      m_words(new word_type[1]()) {}
+
+inline vector<bool>::vector(size_t req_size)
+    : m_size(req_size),
+      m_capacity(bits_to_capacity(req_size)),
+      m_words(new word_type[m_capacity / WORD_BITS]()) {}
+
+inline vector<bool>::vector(std::initializer_list<bool> l)
+    : m_size(l.size()),
+      m_capacity(bits_to_capacity(m_size)),
+      m_words(new word_type[m_capacity / WORD_BITS]()) {
+  size_t i = 0;
+  for (bool elem : l) {
+    if (elem) m_words[i / WORD_BITS] |= word_type(1) << (i % WORD_BITS);
+    i++;
+  }
+}
+
+inline vector<bool>::vector(const vector& other)
+    : m_size(other.m_size),
+      m_capacity(other.m_capacity),
+      m_words(new word_type[other.m_capacity / WORD_BITS]()) {
+  std::memcpy(m_words, other.m_words, words_for(m_size) * sizeof(word_type));
+}
+
+inline vector<bool>::vector(vector&& other)
+    : m_size(other.m_size),
+      m_capacity(other.m_capacity),
+      m_words(other.m_words) {
+  other.m_words = nullptr;
+  other.m_size = 0;
+  other.m_capacity = 0;
+}
+
+inline vector<bool>& vector<bool>::operator=(const vector& other) {
+  if (this != &other) {
+    delete[] m_words;
+    m_size = other.m_size;
+    m_capacity = other.m_capacity;
+    m_words = new word_type[m_capacity / WORD_BITS]();
+    std::memcpy(m_words, other.m_words,
+                words_for(m_size) * sizeof(word_type));
+  }
+  return *this;
+}
+
+inline vector<bool>& vector<bool>::operator=(vector&& other) {
+  if (this == &other) return *this;
+
+  delete[] m_words;
+  m_words = other.m_words;
+  m_size = other.m_size;
+  m_capacity = other.m_capacity;
+  other.m_words = nullptr;
+  other.m_size = 0;
+  other.m_capacity = 0;
+  return *this;
+}
+
+inline vector<bool>::~vector() { delete[] m_words; }
+
+// ———— MEMBER FUNCTIONS ————
+inline void vector<bool>::push_back(bool elem) {
+  if (m_size == m_capacity) double_capacity();
+  reference(&m_words[m_size / WORD_BITS],
+            word_type(1) << (m_size % WORD_BITS)) = elem;
+  m_size++;
+}
+
+template <typename... Args>
+void vector<bool>::emplace_back(Args&&... args) {
+  push_back(bool(std::forward<Args>(args)...));
+}
+
+inline size_t vector<bool>::size() const { return m_size; }
+
+inline size_t vector<bool>::capacity() const { return m_capacity; }
+
+inline bool vector<bool>::empty() const { return m_size == 0; }
+
+inline void vector<bool>::reserve(size_t n) { change_capacity(n); }
+
+inline size_t vector<bool>::count() const {
+  return detail::popcount_words(m_words, words_for(m_size));
+}
+
+inline vector<bool>::word_type* vector<bool>::words() { return m_words; }
+
+inline const vector<bool>::word_type* vector<bool>::words() const {
+  return m_words;
+}
+
+inline bool vector<bool>::operator[](size_t i) const {
+  if (i >= m_size)
+    throw std::out_of_range("Element " + std::to_string(i) +
+                            " is out of range, vector has " +
+                            std::to_string(m_size) + " elements.");
+  return (m_words[i / WORD_BITS] >> (i % WORD_BITS)) & 1;
+}
+
+inline vector<bool>::reference vector<bool>::operator[](size_t i) {
+  if (i >= m_size)
+    throw std::out_of_range("Element " + std::to_string(i) +
+                            " is out of range, vector has " +
+                            std::to_string(m_size) + " elements.");
+  return reference(&m_words[i / WORD_BITS], word_type(1) << (i % WORD_BITS));
+}
+
+inline std::ostream& operator<<(std::ostream& os,
+                                const tjs::vector<bool>& vec) {
+  os << "{ ";
+  for (size_t i = 0; i < vec.size(); i++) {
+    os << vec[i] << " ";
+  }
+  os << "}";
+  return os;
+}
+
+// ———— ITERATOR ————
+inline vector<bool>::iterator::iterator(word_type* word, size_t bit)
+    : word_(word), bit_(bit) {}
+
+inline vector<bool>::iterator::reference vector<bool>::iterator::operator*()
+    const {
+  return reference(word_, word_type(1) << bit_);
+}
+
+inline vector<bool>::iterator& vector<bool>::iterator::operator++() {
+  if (++bit_ == WORD_BITS) {
+    bit_ = 0;
+    ++word_;
+  }
+  return *this;
+}
+
+inline vector<bool>::iterator vector<bool>::iterator::operator++(int) {
+  iterator tmp(*this);
+  ++*this;
+  return tmp;
+}
+
+inline vector<bool>::iterator& vector<bool>::iterator::operator--() {
+  if (bit_ == 0) {
+    bit_ = WORD_BITS - 1;
+    --word_;
+  } else {
+    --bit_;
+  }
+  return *this;
+}
+
+inline vector<bool>::iterator vector<bool>::iterator::operator--(int) {
+  iterator tmp(*this);
+  --*this;
+  return tmp;
+}
+
+inline vector<bool>::iterator vector<bool>::iterator::operator+(
+    difference_type n) const {
+  iterator tmp(*this);
+  return tmp += n;
+}
+
+inline vector<bool>::iterator vector<bool>::iterator::operator-(
+    difference_type n) const {
+  iterator tmp(*this);
+  return tmp -= n;
+}
+
+inline vector<bool>::iterator::difference_type
+vector<bool>::iterator::operator-(const iterator& o) const {
+  return (word_ - o.word_) * static_cast<difference_type>(WORD_BITS) +
+         (static_cast<difference_type>(bit_) -
+          static_cast<difference_type>(o.bit_));
+}
+
+inline vector<bool>::iterator& vector<bool>::iterator::operator+=(
+    difference_type n) {
+  // Floor division, so negative steps borrow from the previous word.
+  difference_type pos = static_cast<difference_type>(bit_) + n;
+  difference_type words = pos / static_cast<difference_type>(WORD_BITS);
+  difference_type bit = pos % static_cast<difference_type>(WORD_BITS);
+  if (bit < 0) {
+    bit += WORD_BITS;
+    words--;
+  }
+  word_ += words;
+  bit_ = static_cast<size_t>(bit);
+  return *this;
+}
+
+inline vector<bool>::iterator& vector<bool>::iterator::operator-=(
+    difference_type n) {
+  return *this += -n;
+}
+
+inline vector<bool>::iterator::reference vector<bool>::iterator::operator[](
+    difference_type n) const {
+  return *(*this + n);
+}
+
+inline bool vector<bool>::iterator::operator==(const iterator& o) const {
+  return word_ == o.word_ && bit_ == o.bit_;
+}
+
+inline bool vector<bool>::iterator::operator!=(const iterator& o) const {
+  return !(*this == o);
+}
+
+inline bool vector<bool>::iterator::operator<(const iterator& o) const {
+  return *this - o < 0;
+}
+
+inline bool vector<bool>::iterator::operator>(const iterator& o) const {
+  return *this - o > 0;
+}
+
+inline bool vector<bool>::iterator::operator<=(const iterator& o) const {
+  return *this - o <= 0;
+}
+
+inline bool vector<bool>::iterator::operator>=(const iterator& o) const {
+  return *this - o >= 0;
+}
+
+inline vector<bool>::iterator vector<bool>::begin() {
+  return iterator(m_words, 0);
+}
+
+inline vector<bool>::iterator vector<bool>::end() {
+  return iterator(m_words + m_size / WORD_BITS, m_size % WORD_BITS);
+}
+
 }  // namespace tjs